@@ -11,6 +11,9 @@ public:
         /// @brief mutagenicity graphs have categorical integer labels on edges and nodes
         static graph<std::string, int> read_mutagenicity(const std::string &path);
 
+        /// @brief read_mutagenicity on an open stream, e.g. a file decompressed from a zip_archive
+        static graph<std::string, int> parse_mutagenicity(std::istream &graphFile);
+
 
         /// @brief nodes are labeled with x,y coordinates, and delaunay triangulation as edges
         static graph<std::pair<double, double>, float> read_CMU(const std::string &path);
@@ -33,7 +36,11 @@ public:
         /// @brief nodes are labeled with aminoacid sequences, multiple edge labels: frequency:{1,2}, type0:{1,2,3,4}, distance0:{double}, type1:{4,5}, distance1:{int}
         static graph<std::pair<int, std::string>, std::tuple<int, int, int>> read_Proteins(const std::string &path);
 
+        static graph<std::pair<int, std::string>, std::tuple<int, int, int>> parse_Proteins(std::istream &graphFile);
+
         static graph<std::string, int> read_AIDS(const std::string &path);
+
+        static graph<std::string, int> parse_AIDS(std::istream &graphFile);
 };
 
 #endif // NETWORKIT_IO_GXL_GRAPH_READER_HPP_
\ No newline at end of file
@@ -0,0 +1,75 @@
+#ifndef GEDC_BOUND_CACHE_HPP
+#define GEDC_BOUND_CACHE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+
+/**
+ * on-disk cache of the best known GED bounds per pair, shared by all runs of a threshold sweep. The file is an append-only
+ * sequence of fixed-size binary records; concurrent processes on one machine append under an exclusive flock, and every
+ * reader folds the records into the tightest lower and upper bound per key. A record only ever tightens a bound, so the
+ * order in which processes append does not matter. Keys are (context, query id, candidate id), where context names the
+ * dataset and cost model, e.g. "aids/uniform", so that one file can serve all executables.
+ */
+class bound_cache {
+public:
+        struct entry {
+                double lower = 0.0;
+                double upper = std::numeric_limits<double>::max();
+
+                /// lower and upper bound met, the GED itself is known
+                [[nodiscard]] bool exact() const { return lower >= upper; }
+        };
+
+        /// @throws std::runtime_error if the file can not be opened or created
+        bound_cache(const std::string &path, const std::string &context);
+
+        ~bound_cache();
+
+        bound_cache(const bound_cache &) = delete;
+
+        bound_cache &operator=(const bound_cache &) = delete;
+
+        /// @brief best known bounds of the pair, including records other processes appended since the last refresh()
+        entry find(std::uint32_t query, std::uint32_t candidate);
+
+        /// @brief appends a record if it tightens the known bounds of the pair, pass 0 / max for a bound that is not known
+        void add(std::uint32_t query, std::uint32_t candidate, double lower, double upper);
+
+        /// @brief reads the records appended to the file since the last call
+        void refresh();
+
+        /// number of pairs with at least one bound
+        [[nodiscard]] std::size_t size() const { return entries_.size(); }
+
+private:
+        /// 32 bytes on disk, magic is written last so that a torn write (padded with zeros by the next writer) never matches
+        struct record {
+                std::uint32_t context;
+                std::uint32_t query;
+                double lower;
+                double upper;
+                std::uint32_t candidate;
+                std::uint32_t magic;
+        };
+        static_assert(sizeof(record) == 32, "bound_cache records have to be 32 bytes");
+
+        static constexpr std::uint32_t magic_ = 0x43444547; // "GEDC"
+
+        int fd_ = -1;
+        std::uint32_t context_;
+        off_t offset_ = 0;
+        std::unordered_map<std::uint64_t, entry> entries_;
+
+        static inline std::uint64_t key(std::uint32_t query, std::uint32_t candidate) {
+                return (static_cast<std::uint64_t>(query) << 32) | candidate;
+        }
+
+        /// @brief folds rec into entries_, returns true if it tightened a bound
+        bool merge(const record &rec);
+};
+
+#endif //GEDC_BOUND_CACHE_HPP
@@ -0,0 +1,99 @@
+#ifndef GEDC_DATASET_REGISTRY_HPP
+#define GEDC_DATASET_REGISTRY_HPP
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+template<typename T, typename U>
+class GraphDatabase;
+
+/**
+ * the graphs of a dataset as listed in its collection XML (data/collections/all*.xml), with the mappings between the
+ * names a graph goes by: file name, numeric id in the file name (the key of bound_cache), position in the collection,
+ * index in a GraphDatabase and GEDLIB GraphID. GEDEnv::load_gxl_graphs() loads the graphs in the order of the collection,
+ * so its result is indexed by collection position. The collection is read once and every lookup is a hash or an array
+ * access, instead of a regex and a linear search per pair.
+ */
+class dataset_registry {
+public:
+        /// @throws std::runtime_error if the collection can not be read, lists no graph or lists a file or id twice
+        explicit dataset_registry(const std::string &collection);
+
+        /// @brief file names listed in a collection XML, in its order
+        /// @throws std::runtime_error if the collection can not be read or lists no graph
+        static std::vector<std::string> collection_files(const std::string &collection);
+
+        /// first number in the file name, 0 if there is none. The key of bound_cache, also used by GraphDatabase.
+        static std::uint32_t file_id(const std::string &file) {
+                std::size_t i = 0;
+                while (i < file.size() && !std::isdigit(static_cast<unsigned char>(file[i]))) {
+                        i++;
+                }
+                std::uint32_t id = 0;
+                for (; i < file.size() && std::isdigit(static_cast<unsigned char>(file[i])); i++) {
+                        id = id * 10 + static_cast<std::uint32_t>(file[i] - '0');
+                }
+                return id;
+        }
+
+        [[nodiscard]] std::size_t size() const { return files_.size(); }
+
+        [[nodiscard]] const std::string &file(std::size_t position) const { return files_[position]; }
+
+        [[nodiscard]] std::uint32_t id(std::size_t position) const { return ids_[position]; }
+
+        /// @brief position of file in the collection
+        /// @throws std::runtime_error if the collection does not list file
+        [[nodiscard]] std::size_t position(const std::string &file) const;
+
+        /// @brief position of the graph with numeric id in the collection
+        /// @throws std::runtime_error if the collection does not list the id
+        [[nodiscard]] std::size_t position_of_id(std::uint32_t id) const;
+
+        [[nodiscard]] bool contains(const std::string &file) const { return positions_.count(file) > 0; }
+
+        /// @brief the GraphIDs GEDEnv::load_gxl_graphs() returned for this collection
+        /// @throws std::runtime_error if their number differs from the collection
+        void set_gedlib_ids(std::vector<std::size_t> ids);
+
+        /// @brief GEDLIB GraphID of the graph at position, set_gedlib_ids() has to be called first
+        [[nodiscard]] std::size_t gedlib_id(std::size_t position) const { return gedlib_ids_[position]; }
+
+        /// @throws std::runtime_error if the collection does not list file
+        [[nodiscard]] std::size_t gedlib_id(const std::string &file) const { return gedlib_ids_[position(file)]; }
+
+        /**
+         * maps the graphs of db to their collection position by file name. A graph the collection does not list has no
+         * GEDLIB GraphID, matching it by its numeric id instead would bind it to another graph (e.g. molecule_test_1.gxl
+         * of the Mutagenicity archive to molecule_1.gxl).
+         * @throws std::runtime_error if db holds a graph the collection does not list
+         */
+        template<typename T, typename U>
+        void bind(const GraphDatabase<T, U> &db) {
+                graph_positions_.assign(db.size(), 0);
+                for (std::size_t i = 0; i < db.size(); i++) {
+                        graph_positions_[i] = position(db.file(i));
+                }
+        }
+
+        /// @brief collection position of graph i of the database passed to bind()
+        [[nodiscard]] std::size_t graph_position(std::size_t i) const { return graph_positions_[i]; }
+
+        /// @brief GEDLIB GraphID of graph i of the database passed to bind()
+        [[nodiscard]] std::size_t graph_gedlib_id(std::size_t i) const { return gedlib_ids_[graph_positions_[i]]; }
+
+private:
+        std::string collection_;
+        std::vector<std::string> files_;
+        std::vector<std::uint32_t> ids_;
+        std::unordered_map<std::string, std::size_t> positions_;
+        std::unordered_map<std::uint32_t, std::size_t> id_positions_;
+        std::vector<std::size_t> gedlib_ids_;
+        std::vector<std::size_t> graph_positions_;
+};
+
+#endif //GEDC_DATASET_REGISTRY_HPP
@@ -0,0 +1,181 @@
+#ifndef GEDC_FILTER_TILES_HPP
+#define GEDC_FILTER_TILES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "graph.hpp"
+#include "worker_pool.hpp"
+
+/**
+ * counts of a graph that the lower bound of get_lower_bound.hpp depends on, with the labels interned by a filter_index.
+ * A signature is a few dozen integers, so all queries can be filtered against the whole database without touching the
+ * graphs again.
+ */
+struct filter_signature {
+        unsigned int nodes = 0;
+        unsigned int edges = 0;
+        /// (label id, number of nodes with it), sorted by label id
+        std::vector<std::pair<std::uint32_t, unsigned int>> node_labels;
+        /// (label id, number of entries of get_edgelist() with it), sorted by label id
+        std::vector<std::pair<std::uint32_t, unsigned int>> edge_labels;
+        /// degree_counts[d] is the number of nodes of degree d, the last entry is not 0
+        std::vector<int> degree_counts;
+};
+
+/**
+ * the cheap lower bound of compute_lower_bound() for many queries against a database in one pass. Signatures are built
+ * once per graph, then lower_bounds() walks the candidates in tiles and evaluates every tile against a tile of queries,
+ * so a candidate signature is loaded once per tile of queries instead of once per query. The bounds are the same values
+ * compute_lower_bound() returns, including its early exits above the upper bound.
+ */
+template<typename T, typename U>
+class filter_index {
+public:
+        /// candidates per tile, a tile of signatures fits into L1 together with the query tile
+        static constexpr std::size_t candidate_tile = 64;
+        static constexpr std::size_t query_tile = 16;
+
+        /// @brief signature of g, labels seen for the first time get the next free id
+        filter_signature signature(const graph<T, U> &g) {
+                filter_signature s;
+                s.nodes = g.number_of_nodes();
+                s.edges = g.number_of_edges();
+                std::map<std::uint32_t, unsigned int> node_counts;
+                std::vector<int> degree_counts;
+                for (node i = 0; i < s.nodes; i++) {
+                        node_counts[intern(node_ids_, g.get_node_label(i))]++;
+                        const auto d = g.get_degree(i);
+                        if (d >= degree_counts.size()) {
+                                degree_counts.resize(d + 1, 0);
+                        }
+                        degree_counts[d]++;
+                }
+                while (!degree_counts.empty() && degree_counts.back() == 0) {
+                        degree_counts.pop_back();
+                }
+                std::map<std::uint32_t, unsigned int> edge_counts;
+                for (auto e: g.get_edgelist()) {
+                        edge_counts[intern(edge_ids_, g.get_edge_label(e))]++;
+                }
+                s.node_labels.assign(node_counts.begin(), node_counts.end());
+                s.edge_labels.assign(edge_counts.begin(), edge_counts.end());
+                s.degree_counts = std::move(degree_counts);
+                return s;
+        }
+
+        /// @brief compute_lower_bound(q, g, upper_bound) from the signatures of q and g
+        static unsigned int lower_bound(const filter_signature &q, const filter_signature &g, unsigned int upper_bound) {
+                const unsigned int n1 = q.nodes, n2 = g.nodes, m1 = q.edges, m2 = g.edges;
+
+                // size
+                unsigned int lb = std::abs((int) n1 - (int) n2) + std::abs((int) m1 - (int) m2) / 2;
+                if (lb > upper_bound) return lb;
+
+                // node labels, every common label saves one substitution
+                lb = std::max(n1, n2) - common(q.node_labels, g.node_labels);
+                if (lb > upper_bound) return lb;
+
+                // degrees, matched from the largest down
+                std::vector<int> degrees_cnt_q(q.degree_counts), degrees_cnt_g(g.degree_counts);
+                int max_degree_q = degrees_cnt_q.empty() ? 0 : static_cast<int>(degrees_cnt_q.size()) - 1;
+                int max_degree_g = degrees_cnt_g.empty() ? 0 : static_cast<int>(degrees_cnt_g.size()) - 1;
+                unsigned int de = 0, ie = 0;
+                while (max_degree_q > 0 && max_degree_g > 0) {
+                        if (degrees_cnt_q[max_degree_q] == 0) { --max_degree_q; continue; }
+                        if (degrees_cnt_g[max_degree_g] == 0) { --max_degree_g; continue; }
+
+                        unsigned int td = std::min(degrees_cnt_q[max_degree_q], degrees_cnt_g[max_degree_g]);
+                        if (max_degree_q > max_degree_g) de += td * (max_degree_q - max_degree_g);
+                        else ie += td * (max_degree_g - max_degree_q);
+
+                        degrees_cnt_q[max_degree_q] -= td;
+                        degrees_cnt_g[max_degree_g] -= td;
+                }
+                while (max_degree_q > 0) {
+                        de += max_degree_q * degrees_cnt_q[max_degree_q];
+                        --max_degree_q;
+                }
+                while (max_degree_g > 0) {
+                        ie += max_degree_g * degrees_cnt_g[max_degree_g];
+                        --max_degree_g;
+                }
+                de = (de + 1) / 2;
+                ie = (ie + 1) / 2;
+
+                unsigned int edge_lb = de + ie;
+                if (lb + edge_lb > upper_bound) return lb + edge_lb;
+
+                // edge labels
+                const unsigned int common_elabel_cnt = common(q.edge_labels, g.edge_labels) / 2;
+                const unsigned int e_cnt = std::max(m1, m2) / 2;
+                const unsigned int edge_label_lb = std::max({de + m2 / 2 - common_elabel_cnt, ie + m1 / 2 - common_elabel_cnt, e_cnt - common_elabel_cnt});
+                edge_lb = std::max(edge_lb, edge_label_lb);
+
+                return lb + edge_lb;
+        }
+
+        /**
+         * lower bounds of every query against every candidate, result[q][c]. The candidate tiles are independent and run
+         * on pool if one is given.
+         */
+        static std::vector<std::vector<unsigned int>> lower_bounds(const std::vector<filter_signature> &queries, const std::vector<filter_signature> &candidates,
+                                                                   unsigned int upper_bound, worker_pool *pool = nullptr) {
+                std::vector<std::vector<unsigned int>> bounds(queries.size(), std::vector<unsigned int>(candidates.size()));
+                const std::size_t tiles = (candidates.size() + candidate_tile - 1) / candidate_tile;
+                auto tile = [&](int, std::size_t t) {
+                        const std::size_t c_begin = t * candidate_tile;
+                        const std::size_t c_end = std::min(candidates.size(), c_begin + candidate_tile);
+                        for (std::size_t q_begin = 0; q_begin < queries.size(); q_begin += query_tile) {
+                                const std::size_t q_end = std::min(queries.size(), q_begin + query_tile);
+                                for (std::size_t c = c_begin; c < c_end; c++) {
+                                        for (std::size_t q = q_begin; q < q_end; q++) {
+                                                bounds[q][c] = lower_bound(queries[q], candidates[c], upper_bound);
+                                        }
+                                }
+                        }
+                };
+                if (pool != nullptr) {
+                        pool->run(tiles, tile);
+                } else {
+                        for (std::size_t t = 0; t < tiles; t++) {
+                                tile(0, t);
+                        }
+                }
+                return bounds;
+        }
+
+private:
+        std::map<T, std::uint32_t> node_ids_;
+        std::map<U, std::uint32_t> edge_ids_;
+
+        template<typename L>
+        static std::uint32_t intern(std::map<L, std::uint32_t> &ids, const L &label) {
+                return ids.emplace(label, static_cast<std::uint32_t>(ids.size())).first->second;
+        }
+
+        /// @brief number of items both sorted (label, count) lists share, the greedy matching of compute_lower_bound()
+        static unsigned int common(const std::vector<std::pair<std::uint32_t, unsigned int>> &a, const std::vector<std::pair<std::uint32_t, unsigned int>> &b) {
+                unsigned int shared = 0;
+                auto i = a.begin();
+                auto j = b.begin();
+                while (i != a.end() && j != b.end()) {
+                        if (i->first < j->first) {
+                                ++i;
+                        } else if (j->first < i->first) {
+                                ++j;
+                        } else {
+                                shared += std::min(i->second, j->second);
+                                ++i;
+                                ++j;
+                        }
+                }
+                return shared;
+        }
+};
+
+#endif //GEDC_FILTER_TILES_HPP
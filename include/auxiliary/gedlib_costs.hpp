@@ -249,4 +249,28 @@ private:
 };
 
 
+/**
+ * translates the node map GEDLIB computed for (g_id, h_id) during run_method() into the 0-based node ids of our graph class
+ * GEDLIB keeps the node ids of the .gxl file ("1" in Mutagenicity/Protein, "_1" in AIDS), our readers store them shifted by one
+ * @return node_map[i] is the node of H that node i of G is substituted with, or -1 if i is deleted
+ */
+inline std::vector<int> getGEDLIBnodeMap(ged::GEDEnv<ged::GXLNodeID, ged::GXLLabel, ged::GXLLabel> &env,
+                                         ged::GEDGraph::GraphID g_id, ged::GEDGraph::GraphID h_id) {
+        auto to_zero_based = [](std::string file_id) {
+                file_id.erase(std::remove(file_id.begin(), file_id.end(), '_'), file_id.end());
+                return static_cast<int>(std::stoul(file_id)) - 1;
+        };
+
+        const ged::NodeMap &gedlib_map = env.get_node_map(g_id, h_id);
+        std::vector<int> node_map(env.get_num_nodes(g_id), -1);
+        for (ged::GEDGraph::NodeID i = 0; i < env.get_num_nodes(g_id); i++) {
+                ged::GEDGraph::NodeID k = gedlib_map.image(i);
+                if (k == ged::GEDGraph::dummy_node()) {
+                        continue;
+                }
+                node_map.at(to_zero_based(env.get_original_node_id(g_id, i))) = to_zero_based(env.get_original_node_id(h_id, k));
+        }
+        return node_map;
+}
+
 #endif //GEDC_GEDLIB_COSTS_HPP
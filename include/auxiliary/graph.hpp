@@ -117,6 +117,18 @@ public:
                 GEDLIB_costs_are_set_ = true;
         }
 
+        /// @brief frees the copied edit costs, cost_function only reads them from the first graph of a pair, so graphs that stay
+        /// resident as candidates do not need to keep the costs of their last pair
+        void releaseGEDLIBeditcosts() {
+                std::vector<std::vector<double>>().swap(GEDLIB_node_sub_cost_);
+                std::vector<double>().swap(GEDLIB_node_del_cost_);
+                std::vector<double>().swap(GEDLIB_node_ins_cost_);
+                std::vector<std::vector<double>>().swap(GEDLIB_edge_sub_cost_);
+                std::vector<double>().swap(GEDLIB_edge_del_cost_);
+                std::vector<double>().swap(GEDLIB_edge_ins_cost_);
+                GEDLIB_costs_are_set_ = false;
+        }
+
         const std::vector<std::vector<double>> &getGedlibNodeSubCost() const {
                 return GEDLIB_node_sub_cost_;
         }
@@ -0,0 +1,374 @@
+#ifndef GEDC_GRAPH_DATABASE_HPP
+#define GEDC_GRAPH_DATABASE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dataset_registry.hpp"
+#include "graph.hpp"
+#include "graph_snapshot.hpp"
+#include "zip_archive.hpp"
+
+/**
+ * a dataset that is parsed once per process and then shared by query selection, filtering and verification, instead of
+ * reading the GXL file of every candidate again for every query. Entries keep the order of the file list they were
+ * loaded from, so outputs list the candidates in the same order as before. A database can also be written to and loaded
+ * from a binary snapshot (see graph_snapshot.hpp), which skips the GXL parsing altogether, or parsed straight out of the
+ * zip archive a dataset is shipped in.
+ */
+template<typename T, typename U>
+class GraphDatabase {
+public:
+        /// what cheap filters need of a graph without touching its adjacency
+        struct signature {
+                std::uint32_t nodes = 0;
+                std::uint32_t edges = 0;
+                std::uint32_t max_degree = 0;
+        };
+
+        using reader = std::function<graph<T, U>(const std::string &)>;
+        /// parses a graph from a stream, e.g. GXLGraphReader::parse_AIDS
+        using stream_reader = std::function<graph<T, U>(std::istream &)>;
+
+        /// @brief loads folder + file for every file of files
+        GraphDatabase(const std::string &folder, const std::vector<std::string> &files, const reader &read) {
+                load(folder, files, read);
+        }
+
+        /// @brief loads every .gxl file of folder, in directory order
+        GraphDatabase(const std::string &folder, const reader &read) {
+                std::vector<std::string> files;
+                for (const auto &entry: std::filesystem::directory_iterator(folder)) {
+                        if (entry.is_regular_file() && entry.path().extension() == ".gxl") {
+                                files.push_back(entry.path().filename().string());
+                        }
+                }
+                load(folder, files, read);
+        }
+
+        [[nodiscard]] std::size_t size() const { return graphs_.size(); }
+
+        [[nodiscard]] const std::vector<std::string> &files() const { return files_; }
+
+        [[nodiscard]] const std::string &file(std::size_t i) const { return files_[i]; }
+
+        /// @brief numeric id in the file name (e.g. 435 for "435.gxl" or "molecule_435.gxl"), the key of bound_cache, unique within the database
+        [[nodiscard]] std::uint32_t id(std::size_t i) const { return ids_[i]; }
+
+        /// the verification writes the edit costs of a pair into its graphs, so graphs are handed out mutable
+        [[nodiscard]] graph<T, U> &get(std::size_t i) { return graphs_[i]; }
+
+        [[nodiscard]] const graph<T, U> &get(std::size_t i) const { return graphs_[i]; }
+
+        [[nodiscard]] const signature &sig(std::size_t i) const { return signatures_[i]; }
+
+        /// @brief position of file in the database, -1 if it was not loaded
+        [[nodiscard]] long index(const std::string &file) const {
+                auto it = index_.find(file);
+                return it == index_.end() ? -1 : static_cast<long>(it->second);
+        }
+
+        [[nodiscard]] bool contains(const std::string &file) const { return index_.count(file) > 0; }
+
+        /// seconds spent parsing the dataset
+        [[nodiscard]] double load_time() const { return load_time_; }
+
+        /// @brief count random files of graphs with min_nodes to max_nodes nodes, seed 0 draws a random seed
+        [[nodiscard]] std::vector<std::string> select_random(std::size_t count, std::uint32_t min_nodes, std::uint32_t max_nodes, int seed = 0) const {
+                std::vector<std::string> eligible;
+                for (std::size_t i = 0; i < size(); i++) {
+                        if (signatures_[i].nodes >= min_nodes && signatures_[i].nodes <= max_nodes) {
+                                eligible.push_back(files_[i]);
+                        }
+                }
+                std::mt19937 gen(seed ? seed : std::random_device{}());
+                std::shuffle(eligible.begin(), eligible.end(), gen);
+                if (eligible.size() > count) {
+                        eligible.resize(count);
+                }
+                return eligible;
+        }
+
+        /**
+         * @brief loads the GXL files of a zip archive without extracting it, file names are the entry names without directories
+         * @param files entries to load in this order, all .gxl entries in archive order if empty
+         * @throws std::runtime_error if the archive can not be read or a file of files is not in it
+         */
+        static GraphDatabase from_zip(const std::string &path, const stream_reader &parse, const std::vector<std::string> &files = {}) {
+                auto start = std::chrono::high_resolution_clock::now();
+                zip_archive zip(path);
+                std::unordered_map<std::string, const zip_archive::entry *> by_name;
+                std::vector<std::string> order;
+                for (const auto &e: zip.entries()) {
+                        const std::string name = e.name.substr(e.name.find_last_of('/') + 1);
+                        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".gxl") == 0) {
+                                by_name.emplace(name, &e);
+                                order.push_back(name);
+                        }
+                }
+                if (!files.empty()) {
+                        order = files;
+                }
+                GraphDatabase db;
+                db.reserve(order.size());
+                for (const auto &file: order) {
+                        auto it = by_name.find(file);
+                        if (it == by_name.end()) {
+                                throw std::runtime_error("GraphDatabase: " + file + " is not in " + path);
+                        }
+                        const std::string contents = zip.extract(*it->second);
+                        memory_streambuf buffer(contents.data(), contents.size());
+                        std::istream in(&buffer);
+                        db.add(file, parse(in), dataset_registry::file_id(file));
+                }
+                db.load_time_ = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+                return db;
+        }
+
+        /// @brief loads a dataset written by save_snapshot() without parsing a single GXL file
+        /// @throws std::runtime_error if the file is not a snapshot or holds graphs with other label types
+        static GraphDatabase from_snapshot(const std::string &path) {
+                auto start = std::chrono::high_resolution_clock::now();
+                GraphDatabase db;
+                graph_snapshot snap(path);
+                if (snap.labels() != snapshot::label_names<T, U>()) {
+                        throw std::runtime_error("GraphDatabase: " + path + " holds labels " + std::string(snap.labels()) + ", expected " +
+                                                 snapshot::label_names<T, U>());
+                }
+                const auto &h = snap.head();
+                std::vector<T> node_labels;
+                node_labels.reserve(h.node_labels);
+                for (std::size_t k = 0; k < h.node_labels; k++) {
+                        node_labels.push_back(snapshot::label_codec<T>::get(snap.node_label(k)));
+                }
+                std::vector<U> edge_labels;
+                edge_labels.reserve(h.edge_labels);
+                for (std::size_t k = 0; k < h.edge_labels; k++) {
+                        edge_labels.push_back(snapshot::label_codec<U>::get(snap.edge_label(k)));
+                }
+                const std::string dataset(snap.dataset());
+                db.reserve(snap.size());
+                for (std::size_t g = 0; g < snap.size(); g++) {
+                        const auto &e = snap.entry(g);
+                        graph<T, U> G;
+                        G.set_graph_id(std::string(snap.graph_id(g)));
+                        G.set_dataset(dataset);
+                        const std::uint32_t *ids = snap.node_ids(g);
+                        const std::uint32_t *labels = snap.node_labels(g);
+                        const std::uint32_t *original = snap.original_node_ids(g);
+                        for (std::uint32_t i = 0; i < e.nodes; i++) {
+                                G.add_node(ids[i], node_labels[labels[i]]);
+                                G.set_original_nodeID(ids[i], original[i]);
+                        }
+                        const std::uint32_t *sources = snap.edge_sources(g);
+                        const std::uint32_t *targets = snap.edge_targets(g);
+                        const std::uint32_t *edge_label_ids = snap.edge_labels(g);
+                        for (std::uint32_t ij = 0; ij < e.edges; ij++) {
+                                G.add_edge(sources[ij], targets[ij], edge_labels[edge_label_ids[ij]]);
+                        }
+                        db.add(std::string(snap.file(g)), std::move(G), e.id);
+                }
+                db.load_time_ = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+                return db;
+        }
+
+        /**
+         * @brief writes the database in the snapshot format of graph_snapshot.hpp
+         * nodes have to be numbered 0..n-1, as for every graph read by GXLGraphReader
+         * @throws std::runtime_error if the file can not be written
+         */
+        void save_snapshot(const std::string &path) {
+                snapshot::header h{};
+                std::memcpy(h.magic, snapshot::magic, sizeof(h.magic));
+                h.version = snapshot::version;
+                h.byte_order = snapshot::byte_order;
+                const std::string label_names = snapshot::label_names<T, U>();
+                label_names.copy(h.labels, sizeof(h.labels) - 1);
+                const std::string dataset = graphs_.empty() ? "" : graphs_.front().get_dataset();
+                if (dataset.size() >= sizeof(h.dataset)) {
+                        throw std::runtime_error("GraphDatabase: dataset name " + dataset + " is too long for a snapshot");
+                }
+                dataset.copy(h.dataset, sizeof(h.dataset) - 1);
+                h.graphs = size();
+
+                // label dictionaries in order of first use
+                std::map<T, std::uint32_t> node_ids;
+                std::map<U, std::uint32_t> edge_ids;
+                std::vector<const T *> node_dictionary;
+                std::vector<const U *> edge_dictionary;
+                auto node_label_id = [&](const T &label) {
+                        auto [it, added] = node_ids.emplace(label, static_cast<std::uint32_t>(node_dictionary.size()));
+                        if (added) {
+                                node_dictionary.push_back(&it->first);
+                        }
+                        return it->second;
+                };
+                auto edge_label_id = [&](const U &label) {
+                        auto [it, added] = edge_ids.emplace(label, static_cast<std::uint32_t>(edge_dictionary.size()));
+                        if (added) {
+                                edge_dictionary.push_back(&it->first);
+                        }
+                        return it->second;
+                };
+
+                std::vector<snapshot::entry> entries(size());
+                std::vector<std::uint32_t> nodes[3];
+                std::vector<std::uint32_t> edges[3];
+                std::vector<std::uint32_t> csr;
+                std::vector<std::uint32_t> adjacency;
+                std::string blob;
+                for (std::size_t g = 0; g < size(); g++) {
+                        auto &G = graphs_[g];
+                        auto &e = entries[g];
+                        e.file_offset = blob.size();
+                        e.file_length = static_cast<std::uint32_t>(files_[g].size());
+                        blob += files_[g];
+                        const std::string graph_id = G.get_graph_id();
+                        e.graph_id_offset = blob.size();
+                        e.graph_id_length = static_cast<std::uint32_t>(graph_id.size());
+                        blob += graph_id;
+                        e.id = ids_[g];
+                        e.nodes = signatures_[g].nodes;
+                        e.edges = signatures_[g].edges;
+                        e.max_degree = signatures_[g].max_degree;
+                        e.first_node = nodes[0].size();
+                        e.first_edge = edges[0].size();
+                        for (std::uint32_t i = 0; i < e.nodes; i++) {
+                                const auto v = G.get_node(i);
+                                nodes[0].push_back(v);
+                                nodes[1].push_back(node_label_id(G.get_node_label(v)));
+                                nodes[2].push_back(G.get_original_nodeID(v));
+                        }
+                        for (std::uint32_t ij = 0; ij < e.edges; ij++) {
+                                const auto [u, v] = G.get_edge(ij);
+                                edges[0].push_back(u);
+                                edges[1].push_back(v);
+                                edges[2].push_back(edge_label_id(G.get_edge_label(static_cast<idx>(ij))));
+                        }
+                        const std::uint32_t row_start = adjacency.size();
+                        for (std::uint32_t v = 0; v < e.nodes; v++) {
+                                csr.push_back(static_cast<std::uint32_t>(adjacency.size()) - row_start);
+                                for (auto w: G.get_neighbors(v)) {
+                                        adjacency.push_back(w);
+                                }
+                        }
+                        csr.push_back(static_cast<std::uint32_t>(adjacency.size()) - row_start);
+                }
+                std::vector<std::uint64_t> dictionary;
+                for (const T *label: node_dictionary) {
+                        dictionary.push_back(blob.size());
+                        snapshot::label_codec<T>::put(blob, *label);
+                }
+                dictionary.push_back(blob.size());
+                for (const U *label: edge_dictionary) {
+                        dictionary.push_back(blob.size());
+                        snapshot::label_codec<U>::put(blob, *label);
+                }
+                dictionary.push_back(blob.size());
+
+                h.nodes = nodes[0].size();
+                h.edges = edges[0].size();
+                h.node_labels = node_dictionary.size();
+                h.edge_labels = edge_dictionary.size();
+                h.entries_offset = snapshot::align(sizeof(h));
+                h.nodes_offset = snapshot::align(h.entries_offset + entries.size() * sizeof(snapshot::entry));
+                h.edges_offset = snapshot::align(h.nodes_offset + 3 * h.nodes * sizeof(std::uint32_t));
+                h.csr_offset = snapshot::align(h.edges_offset + 3 * h.edges * sizeof(std::uint32_t));
+                h.adjacency_offset = snapshot::align(h.csr_offset + csr.size() * sizeof(std::uint32_t));
+                h.dictionary_offset = snapshot::align(h.adjacency_offset + adjacency.size() * sizeof(std::uint32_t));
+                h.blob_offset = snapshot::align(h.dictionary_offset + dictionary.size() * sizeof(std::uint64_t));
+                h.file_size = h.blob_offset + blob.size();
+
+                std::ofstream out(path, std::ios::binary | std::ios::trunc);
+                if (!out) {
+                        throw std::runtime_error("GraphDatabase: can not write " + path);
+                }
+                auto write_at = [&out](std::uint64_t offset, const void *data, std::size_t bytes) {
+                        static const char zeros[8] = {};
+                        while (static_cast<std::uint64_t>(out.tellp()) < offset) {
+                                out.write(zeros, std::min<std::uint64_t>(sizeof(zeros), offset - out.tellp()));
+                        }
+                        out.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+                };
+                write_at(0, &h, sizeof(h));
+                write_at(h.entries_offset, entries.data(), entries.size() * sizeof(snapshot::entry));
+                write_at(h.nodes_offset, nodes[0].data(), nodes[0].size() * sizeof(std::uint32_t));
+                write_at(h.nodes_offset + h.nodes * sizeof(std::uint32_t), nodes[1].data(), nodes[1].size() * sizeof(std::uint32_t));
+                write_at(h.nodes_offset + 2 * h.nodes * sizeof(std::uint32_t), nodes[2].data(), nodes[2].size() * sizeof(std::uint32_t));
+                write_at(h.edges_offset, edges[0].data(), edges[0].size() * sizeof(std::uint32_t));
+                write_at(h.edges_offset + h.edges * sizeof(std::uint32_t), edges[1].data(), edges[1].size() * sizeof(std::uint32_t));
+                write_at(h.edges_offset + 2 * h.edges * sizeof(std::uint32_t), edges[2].data(), edges[2].size() * sizeof(std::uint32_t));
+                write_at(h.csr_offset, csr.data(), csr.size() * sizeof(std::uint32_t));
+                write_at(h.adjacency_offset, adjacency.data(), adjacency.size() * sizeof(std::uint32_t));
+                write_at(h.dictionary_offset, dictionary.data(), dictionary.size() * sizeof(std::uint64_t));
+                write_at(h.blob_offset, blob.data(), blob.size());
+                if (!out.flush()) {
+                        throw std::runtime_error("GraphDatabase: can not write " + path);
+                }
+        }
+
+private:
+        std::vector<std::string> files_;
+        std::vector<std::uint32_t> ids_;
+        std::vector<graph<T, U>> graphs_;
+        std::vector<signature> signatures_;
+        std::unordered_map<std::string, std::size_t> index_;
+        std::unordered_map<std::uint32_t, std::size_t> id_index_;
+        double load_time_ = 0.0;
+
+        GraphDatabase() = default;
+
+        void reserve(std::size_t n) {
+                files_.reserve(n);
+                index_.reserve(n);
+                id_index_.reserve(n);
+                graphs_.reserve(n);
+                ids_.reserve(n);
+                signatures_.reserve(n);
+        }
+
+        void add(std::string file, graph<T, U> g, std::uint32_t id) {
+                signature s;
+                s.nodes = g.number_of_nodes();
+                s.edges = g.number_of_edges();
+                for (std::uint32_t v = 0; v < s.nodes; v++) {
+                        s.max_degree = std::max<std::uint32_t>(s.max_degree, g.get_degree(v));
+                }
+                if (!index_.emplace(file, files_.size()).second) {
+                        throw std::runtime_error("GraphDatabase: " + file + " is listed twice");
+                }
+                // bound_cache keys the pairs by id, two graphs with one id would share their cached bounds
+                auto [other, added] = id_index_.emplace(id, files_.size());
+                if (!added) {
+                        throw std::runtime_error("GraphDatabase: " + file + " has the id " + std::to_string(id) + " of " + files_[other->second]);
+                }
+                files_.push_back(std::move(file));
+                graphs_.push_back(std::move(g));
+                ids_.push_back(id);
+                signatures_.push_back(s);
+        }
+
+        void load(const std::string &folder, const std::vector<std::string> &files, const reader &read) {
+                auto start = std::chrono::high_resolution_clock::now();
+                reserve(files.size());
+                for (const auto &file: files) {
+                        add(file, read(folder + file), dataset_registry::file_id(file));
+                }
+                load_time_ = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        }
+};
+
+#endif //GEDC_GRAPH_DATABASE_HPP
@@ -0,0 +1,210 @@
+#ifndef GEDC_GRAPH_SNAPSHOT_HPP
+#define GEDC_GRAPH_SNAPSHOT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+/**
+ * binary snapshot of a whole dataset, written by convert_snapshot and mapped read-only by graph_snapshot, so a process
+ * starts without parsing GXL files and all processes on a machine share one page cache copy of the dataset.
+ *
+ * layout (native byte order, every section 8 byte aligned):
+ *      header
+ *      entries         one per graph: names, signature and where its nodes, edges and adjacency start
+ *      nodes           3 x total nodes uint32: node ids in insertion order, node label ids, original (file) node ids
+ *      edges           3 x total edges uint32: first node, second node, edge label id, in edge list order
+ *      csr             per graph nodes + 1 uint32 row offsets into its adjacency, the rows of graph g start at first_node + g
+ *      adjacency       2 x total edges uint32 neighbours, every row in the order of graph::get_neighbors
+ *      dictionary      node labels + 1 and edge labels + 1 uint64 offsets into the blob, one encoded label each
+ *      blob            file names, graph ids and encoded labels
+ */
+namespace snapshot {
+        constexpr char magic[8] = {'G', 'E', 'D', 'C', 'S', 'N', 'A', 'P'};
+        constexpr std::uint32_t version = 1;
+        /// reads back as 0x04030201 on a machine with the other byte order
+        constexpr std::uint32_t byte_order = 0x01020304;
+
+        struct header {
+                char magic[8];
+                std::uint32_t version;
+                std::uint32_t byte_order;
+                /// label_codec names of the node and edge labels, "node|edge"
+                char labels[48];
+                /// graph::get_dataset() of the graphs, cost_function depends on it
+                char dataset[16];
+                std::uint64_t graphs;
+                std::uint64_t nodes;
+                std::uint64_t edges;
+                std::uint64_t node_labels;
+                std::uint64_t edge_labels;
+                std::uint64_t entries_offset;
+                std::uint64_t nodes_offset;
+                std::uint64_t edges_offset;
+                std::uint64_t csr_offset;
+                std::uint64_t adjacency_offset;
+                std::uint64_t dictionary_offset;
+                std::uint64_t blob_offset;
+                std::uint64_t file_size;
+        };
+        static_assert(sizeof(header) == 184, "snapshot header has to be 184 bytes");
+
+        struct entry {
+                std::uint64_t file_offset;
+                std::uint64_t graph_id_offset;
+                std::uint32_t file_length;
+                std::uint32_t graph_id_length;
+                std::uint32_t id;
+                std::uint32_t nodes;
+                std::uint32_t edges;
+                std::uint32_t max_degree;
+                std::uint64_t first_node;
+                std::uint64_t first_edge;
+        };
+        static_assert(sizeof(entry) == 56, "snapshot entries have to be 56 bytes");
+
+        inline std::uint64_t align(std::uint64_t offset) { return (offset + 7) & ~std::uint64_t{7}; }
+
+        /**
+         * byte encoding of the label types of the datasets, labels are stored once per distinct value in the dictionary
+         * @tparam L node or edge label type
+         */
+        template<typename L>
+        struct label_codec;
+
+        template<>
+        struct label_codec<int> {
+                static constexpr const char *name = "int";
+
+                static void put(std::string &out, int value) { out.append(reinterpret_cast<const char *>(&value), sizeof(value)); }
+
+                static int get(std::string_view in) {
+                        int value;
+                        std::memcpy(&value, in.data(), sizeof(value));
+                        return value;
+                }
+        };
+
+        template<>
+        struct label_codec<std::string> {
+                static constexpr const char *name = "string";
+
+                static void put(std::string &out, const std::string &value) { out.append(value); }
+
+                static std::string get(std::string_view in) { return std::string(in); }
+        };
+
+        /// protein nodes: type and amino acid sequence
+        template<>
+        struct label_codec<std::pair<int, std::string>> {
+                static constexpr const char *name = "int,string";
+
+                static void put(std::string &out, const std::pair<int, std::string> &value) {
+                        label_codec<int>::put(out, value.first);
+                        out.append(value.second);
+                }
+
+                static std::pair<int, std::string> get(std::string_view in) {
+                        return {label_codec<int>::get(in), std::string(in.substr(sizeof(int)))};
+                }
+        };
+
+        /// protein edges: frequency and the types of up to two connections
+        template<>
+        struct label_codec<std::tuple<int, int, int>> {
+                static constexpr const char *name = "int,int,int";
+
+                static void put(std::string &out, const std::tuple<int, int, int> &value) {
+                        label_codec<int>::put(out, std::get<0>(value));
+                        label_codec<int>::put(out, std::get<1>(value));
+                        label_codec<int>::put(out, std::get<2>(value));
+                }
+
+                static std::tuple<int, int, int> get(std::string_view in) {
+                        return {label_codec<int>::get(in), label_codec<int>::get(in.substr(sizeof(int))),
+                                label_codec<int>::get(in.substr(2 * sizeof(int)))};
+                }
+        };
+
+        template<typename T, typename U>
+        std::string label_names() { return std::string(label_codec<T>::name) + "|" + label_codec<U>::name; }
+}
+
+/**
+ * a snapshot file mapped read-only. The mapping is private to this object but backed by the page cache, so every
+ * process that maps the same file shares its pages. The accessors do not copy, GraphDatabase decodes the graphs from them.
+ */
+class graph_snapshot {
+public:
+        /// @throws std::runtime_error if the file can not be mapped or is not a snapshot of this version and byte order
+        explicit graph_snapshot(const std::string &path);
+
+        ~graph_snapshot();
+
+        graph_snapshot(const graph_snapshot &) = delete;
+
+        graph_snapshot &operator=(const graph_snapshot &) = delete;
+
+        [[nodiscard]] const snapshot::header &head() const { return *reinterpret_cast<const snapshot::header *>(data_); }
+
+        [[nodiscard]] std::size_t size() const { return head().graphs; }
+
+        [[nodiscard]] const snapshot::entry &entry(std::size_t g) const { return section<snapshot::entry>(head().entries_offset)[g]; }
+
+        [[nodiscard]] std::string_view file(std::size_t g) const { return blob(entry(g).file_offset, entry(g).file_length); }
+
+        [[nodiscard]] std::string_view graph_id(std::size_t g) const { return blob(entry(g).graph_id_offset, entry(g).graph_id_length); }
+
+        [[nodiscard]] std::string_view dataset() const { return {head().dataset, strnlen(head().dataset, sizeof(head().dataset))}; }
+
+        [[nodiscard]] std::string_view labels() const { return {head().labels, strnlen(head().labels, sizeof(head().labels))}; }
+
+        /// node ids of graph g in insertion order
+        [[nodiscard]] const std::uint32_t *node_ids(std::size_t g) const { return nodes_column(0) + entry(g).first_node; }
+
+        [[nodiscard]] const std::uint32_t *node_labels(std::size_t g) const { return nodes_column(1) + entry(g).first_node; }
+
+        [[nodiscard]] const std::uint32_t *original_node_ids(std::size_t g) const { return nodes_column(2) + entry(g).first_node; }
+
+        [[nodiscard]] const std::uint32_t *edge_sources(std::size_t g) const { return edges_column(0) + entry(g).first_edge; }
+
+        [[nodiscard]] const std::uint32_t *edge_targets(std::size_t g) const { return edges_column(1) + entry(g).first_edge; }
+
+        [[nodiscard]] const std::uint32_t *edge_labels(std::size_t g) const { return edges_column(2) + entry(g).first_edge; }
+
+        /// @brief neighbours of node v of graph g as [first, last)
+        [[nodiscard]] std::pair<const std::uint32_t *, const std::uint32_t *> neighbors(std::size_t g, std::uint32_t v) const {
+                const std::uint32_t *rows = section<std::uint32_t>(head().csr_offset) + entry(g).first_node + g;
+                const std::uint32_t *adjacency = section<std::uint32_t>(head().adjacency_offset) + 2 * entry(g).first_edge;
+                return {adjacency + rows[v], adjacency + rows[v + 1]};
+        }
+
+        /// encoded node label k, decode with snapshot::label_codec
+        [[nodiscard]] std::string_view node_label(std::size_t k) const { return dictionary(k); }
+
+        [[nodiscard]] std::string_view edge_label(std::size_t k) const { return dictionary(head().node_labels + 1 + k); }
+
+private:
+        const char *data_ = nullptr;
+        std::size_t length_ = 0;
+
+        template<typename S>
+        const S *section(std::uint64_t offset) const { return reinterpret_cast<const S *>(data_ + offset); }
+
+        [[nodiscard]] const std::uint32_t *nodes_column(int c) const { return section<std::uint32_t>(head().nodes_offset) + c * head().nodes; }
+
+        [[nodiscard]] const std::uint32_t *edges_column(int c) const { return section<std::uint32_t>(head().edges_offset) + c * head().edges; }
+
+        [[nodiscard]] std::string_view blob(std::uint64_t offset, std::uint64_t length) const { return {data_ + head().blob_offset + offset, length}; }
+
+        [[nodiscard]] std::string_view dictionary(std::size_t k) const {
+                const std::uint64_t *offsets = section<std::uint64_t>(head().dictionary_offset);
+                return blob(offsets[k], offsets[k + 1] - offsets[k]);
+        }
+};
+
+#endif //GEDC_GRAPH_SNAPSHOT_HPP
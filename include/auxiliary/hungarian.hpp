@@ -0,0 +1,83 @@
+#ifndef GEDC_HUNGARIAN_HPP
+#define GEDC_HUNGARIAN_HPP
+
+#include <limits>
+#include <vector>
+
+/**
+ * minimum cost assignment of a square n x n cost matrix (row major) with the O(n^3) shortest augmenting path version
+ * of the hungarian method. Used for the small LSAPs of the Lagrangian bound, where calling into an external LSAP
+ * library per subproblem would cost more than solving it.
+ * @param row_to_col on return row_to_col[i] is the column assigned to row i
+ * @param reduced_cost if not nullptr, receives cost - u - v for the optimal dual potentials u, v (row major, all >= 0),
+ * forcing row i onto column j increases the optimum by at least reduced_cost[i * n + j]
+ * @return cost of the assignment
+ */
+inline double hungarian(const std::vector<double> &cost, int n, std::vector<int> &row_to_col, std::vector<double> *reduced_cost = nullptr) {
+        const double inf = std::numeric_limits<double>::infinity();
+        // 1-based potentials and column matching, p[j] = row matched to column j, column 0 is the virtual start column
+        std::vector<double> u(n + 1, 0.0), v(n + 1, 0.0), minv(n + 1);
+        std::vector<int> p(n + 1, 0), way(n + 1, 0);
+        std::vector<bool> used(n + 1);
+
+        for (int i = 1; i <= n; i++) {
+                p[0] = i;
+                int j0 = 0;
+                std::fill(minv.begin(), minv.end(), inf);
+                std::fill(used.begin(), used.end(), false);
+                do {
+                        used[j0] = true;
+                        int i0 = p[j0];
+                        int j1 = 0;
+                        double delta = inf;
+                        for (int j = 1; j <= n; j++) {
+                                if (used[j]) {
+                                        continue;
+                                }
+                                double cur = cost[(i0 - 1) * n + (j - 1)] - u[i0] - v[j];
+                                if (cur < minv[j]) {
+                                        minv[j] = cur;
+                                        way[j] = j0;
+                                }
+                                if (minv[j] < delta) {
+                                        delta = minv[j];
+                                        j1 = j;
+                                }
+                        }
+                        for (int j = 0; j <= n; j++) {
+                                if (used[j]) {
+                                        u[p[j]] += delta;
+                                        v[j] -= delta;
+                                } else {
+                                        minv[j] -= delta;
+                                }
+                        }
+                        j0 = j1;
+                } while (p[j0] != 0);
+                do {
+                        int j1 = way[j0];
+                        p[j0] = p[j1];
+                        j0 = j1;
+                } while (j0 != 0);
+        }
+
+        row_to_col.assign(n, -1);
+        double total = 0.0;
+        for (int j = 1; j <= n; j++) {
+                if (p[j] != 0) {
+                        row_to_col[p[j] - 1] = j - 1;
+                        total += cost[(p[j] - 1) * n + (j - 1)];
+                }
+        }
+        if (reduced_cost != nullptr) {
+                reduced_cost->resize(static_cast<std::size_t>(n) * n);
+                for (int i = 0; i < n; i++) {
+                        for (int j = 0; j < n; j++) {
+                                (*reduced_cost)[i * n + j] = cost[i * n + j] - u[i + 1] - v[j + 1];
+                        }
+                }
+        }
+        return total;
+}
+
+#endif //GEDC_HUNGARIAN_HPP
@@ -26,6 +26,9 @@ namespace IO {
 
         std::string create_verification_output(options &opt);
 
+        /// @brief the results of a sweep (opt.thresholds) for one of its thresholds, read off the per candidate bounds
+        options threshold_output(const options &opt, double threshold);
+
         std::string createGurobiOutput(options &opt);
 
         void writeJsonToFile(const options &opt);
@@ -0,0 +1,230 @@
+#ifndef GEDC_LAGRANGIAN_BOUND_HPP
+#define GEDC_LAGRANGIAN_BOUND_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "graph.hpp"
+#include "hungarian.hpp"
+
+/**
+ * Lagrangian relaxation of the FORI topological constraints, used by FORI_VERIFICATION to reject a pair before the LP.
+ *
+ * Every edge variable z (edge ij of G onto edge kl of H in one orientation) maps one end point pair (i,k) and one end
+ * point pair (j,l). It is duplicated into a copy owned by (i,k) and a copy owned by (j,l), each carrying half of its
+ * cost, and the equality of the copies is dualized with multipliers mu. For fixed mu the topological constraints of the
+ * copies owned by (i,k) only say that, if x_ik = 1, the edges incident to i are matched with the edges incident to k,
+ * so the relaxation splits into one small LSAP per (i,k) whose value v_ik is added to c_ik, and one LSAP over the nodes.
+ * The multipliers are improved with subgradient steps, the best value found is a lower bound on GED(G, H).
+ */
+template<typename T, typename U>
+class LAGRANGIAN_BOUND {
+private:
+        graph<T, U> &G_;
+        graph<T, U> &H_;
+        const std::vector<std::vector<double>> &c_ik_;
+        const std::vector<double> &c_ie_;
+        const std::vector<double> &c_ek_;
+        const std::vector<std::vector<double>> &c_ijkl_;
+        const std::vector<double> &c_ije_;
+        const std::vector<double> &c_ekl_;
+        double constant_ = 0.0;
+
+        std::vector<std::vector<int>> inc_G_;
+        std::vector<std::vector<int>> inc_H_;
+        /// mu_[(ij * m_h + kl) * 2 + orientation], orientation 0: first->first, 1: first->second as in FORI
+        std::vector<double> mu_;
+        std::vector<double> subgradient_;
+        std::vector<int> touched_;
+        /// star_match_[i * n_h + k][r] = edge of H matched with the r-th edge incident to i, -1 if none
+        std::vector<std::vector<int>> star_match_;
+        std::vector<double> star_value_;
+        std::vector<double> lsap_cost_;
+        std::vector<int> lsap_assignment_;
+        /// reduced costs of the node LSAP in the last evaluation (max(n_g, n_h) squared) and in the best one (n_g x n_h)
+        std::vector<double> master_rc_;
+        std::vector<double> best_node_rc_;
+
+        int iterations_ = 0;
+
+        [[nodiscard]] inline int n_h() const { return static_cast<int>(H_.number_of_nodes()); }
+
+        [[nodiscard]] inline int m_h() const { return static_cast<int>(H_.number_of_edges()); }
+
+        /// @brief index into mu_ of the edge variable mapping i->k that belongs to edge ij of G and edge kl of H, owner is +1 if (i,k) owns the first copy
+        inline std::size_t var_index(int i, int ij, int k, int kl, int &owner) const {
+                bool i_first = G_.get_edge(ij).first == i;
+                bool k_first = H_.get_edge(kl).first == k;
+                owner = i_first ? 1 : -1;
+                int orientation = i_first == k_first ? 0 : 1;
+                return (static_cast<std::size_t>(ij) * m_h() + kl) * 2 + orientation;
+        }
+
+        /**
+         * min cost partial assignment of the rows x cols block of lsap_cost_ (n x n, n = max(rows, cols), zero padded).
+         * Entries >= 0 are never worth taking, so they are clamped to 0, which stands for unassigned.
+         */
+        double solve_partial_lsap(int rows, int cols, std::vector<int> &row_to_col, std::vector<double> *reduced_cost = nullptr) {
+                int n = std::max(rows, cols);
+                for (auto &c: lsap_cost_) {
+                        c = std::min(c, 0.0);
+                }
+                double value = hungarian(lsap_cost_, n, lsap_assignment_, reduced_cost);
+                row_to_col.assign(rows, -1);
+                for (int r = 0; r < rows; r++) {
+                        int c = lsap_assignment_[r];
+                        if (c < cols and lsap_cost_[static_cast<std::size_t>(r) * n + c] < 0) {
+                                row_to_col[r] = c;
+                        }
+                }
+                return value;
+        }
+
+        /// @brief value of the relaxation for the current multipliers, node_map receives the node assignment of the master LSAP
+        double evaluate(std::vector<int> &node_map) {
+                const int n_g = static_cast<int>(G_.number_of_nodes());
+                for (int i = 0; i < n_g; i++) {
+                        auto rows = static_cast<int>(inc_G_[i].size());
+                        for (int k = 0; k < n_h(); k++) {
+                                auto cols = static_cast<int>(inc_H_[k].size());
+                                auto &match = star_match_[i * n_h() + k];
+                                if (rows == 0 or cols == 0) {
+                                        match.assign(rows, -1);
+                                        star_value_[i * n_h() + k] = 0.0;
+                                        continue;
+                                }
+                                int n = std::max(rows, cols);
+                                lsap_cost_.assign(static_cast<std::size_t>(n) * n, 0.0);
+                                for (int r = 0; r < rows; r++) {
+                                        int ij = inc_G_[i][r];
+                                        for (int c = 0; c < cols; c++) {
+                                                int kl = inc_H_[k][c];
+                                                int owner;
+                                                auto v = var_index(i, ij, k, kl, owner);
+                                                lsap_cost_[static_cast<std::size_t>(r) * n + c] =
+                                                        0.5 * (c_ijkl_[ij][kl] - c_ije_[ij] - c_ekl_[kl]) + owner * mu_[v];
+                                        }
+                                }
+                                star_value_[i * n_h() + k] = solve_partial_lsap(rows, cols, match);
+                        }
+                }
+
+                int n = std::max(n_g, n_h());
+                lsap_cost_.assign(static_cast<std::size_t>(n) * n, 0.0);
+                for (int i = 0; i < n_g; i++) {
+                        for (int k = 0; k < n_h(); k++) {
+                                lsap_cost_[static_cast<std::size_t>(i) * n + k] = c_ik_[i][k] - c_ie_[i] - c_ek_[k] + star_value_[i * n_h() + k];
+                        }
+                }
+                double value = solve_partial_lsap(n_g, n_h(), node_map, &master_rc_);
+                return constant_ + value;
+        }
+
+public:
+        /// edit costs as computed by graph::cost_function, they have to outlive the object
+        LAGRANGIAN_BOUND(graph<T, U> &G, graph<T, U> &H,
+                         const std::vector<std::vector<double>> &c_ik, const std::vector<double> &c_ie, const std::vector<double> &c_ek,
+                         const std::vector<std::vector<double>> &c_ijkl, const std::vector<double> &c_ije, const std::vector<double> &c_ekl)
+                : G_(G), H_(H), c_ik_(c_ik), c_ie_(c_ie), c_ek_(c_ek), c_ijkl_(c_ijkl), c_ije_(c_ije), c_ekl_(c_ekl) {
+                for (double c: c_ie) constant_ += c;
+                for (double c: c_ek) constant_ += c;
+                for (double c: c_ije) constant_ += c;
+                for (double c: c_ekl) constant_ += c;
+                inc_G_.resize(G.number_of_nodes());
+                for (int ij = 0; ij < G.number_of_edges(); ij++) {
+                        inc_G_[G.get_edge(ij).first].push_back(ij);
+                        inc_G_[G.get_edge(ij).second].push_back(ij);
+                }
+                inc_H_.resize(H.number_of_nodes());
+                for (int kl = 0; kl < H.number_of_edges(); kl++) {
+                        inc_H_[H.get_edge(kl).first].push_back(kl);
+                        inc_H_[H.get_edge(kl).second].push_back(kl);
+                }
+                mu_.assign(static_cast<std::size_t>(G.number_of_edges()) * H.number_of_edges() * 2, 0.0);
+                subgradient_.assign(mu_.size(), 0.0);
+                star_match_.resize(static_cast<std::size_t>(G.number_of_nodes()) * H.number_of_nodes());
+                star_value_.assign(star_match_.size(), 0.0);
+                best_node_rc_.assign(star_match_.size(), 0.0);
+        }
+
+        /**
+         * subgradient optimization of the multipliers, stops early as soon as the bound exceeds threshold
+         * @return best lower bound found, including the constant
+         */
+        double bound(double threshold, int max_iterations) {
+                const double target = threshold + 1.0 + 0.05 * std::abs(threshold);
+                double best = -std::numeric_limits<double>::infinity();
+                double theta = 2.0;
+                int no_improvement = 0;
+                std::vector<int> node_map;
+
+                for (iterations_ = 1; iterations_ <= max_iterations; iterations_++) {
+                        double value = evaluate(node_map);
+                        if (value > best + 1e-9) {
+                                best = value;
+                                no_improvement = 0;
+                                int n = std::max(static_cast<int>(G_.number_of_nodes()), n_h());
+                                for (int i = 0; i < G_.number_of_nodes(); i++) {
+                                        for (int k = 0; k < n_h(); k++) {
+                                                best_node_rc_[i * n_h() + k] = master_rc_[static_cast<std::size_t>(i) * n + k];
+                                        }
+                                }
+                        } else if (++no_improvement >= 5) {
+                                theta /= 2;
+                                no_improvement = 0;
+                        }
+                        if (best > threshold + 1e-6 or iterations_ == max_iterations) {
+                                break;
+                        }
+
+                        // subgradient: copy owned by (i,k) minus copy owned by (j,l)
+                        for (auto v: touched_) {
+                                subgradient_[v] = 0.0;
+                        }
+                        touched_.clear();
+                        for (int i = 0; i < G_.number_of_nodes(); i++) {
+                                int k = node_map[i];
+                                if (k < 0) {
+                                        continue;
+                                }
+                                const auto &match = star_match_[i * n_h() + k];
+                                for (std::size_t r = 0; r < match.size(); r++) {
+                                        if (match[r] < 0) {
+                                                continue;
+                                        }
+                                        int owner;
+                                        auto v = var_index(i, inc_G_[i][r], k, inc_H_[k][match[r]], owner);
+                                        subgradient_[v] += owner;
+                                        touched_.push_back(static_cast<int>(v));
+                                }
+                        }
+                        double norm = 0.0;
+                        std::sort(touched_.begin(), touched_.end());
+                        touched_.erase(std::unique(touched_.begin(), touched_.end()), touched_.end());
+                        for (auto v: touched_) {
+                                norm += subgradient_[v] * subgradient_[v];
+                        }
+                        if (norm == 0.0) {
+                                // copies agree, the multipliers are optimal
+                                break;
+                        }
+                        double step = theta * (target - value) / norm;
+                        for (auto v: touched_) {
+                                mu_[v] += step * subgradient_[v];
+                        }
+                }
+                return best;
+        }
+
+        [[nodiscard]] int iterations() const { return iterations_; }
+
+        /**
+         * reduced cost of x_ik in the relaxation that gave the best bound: every solution with x_ik = 1 costs at least
+         * bound() + node_reduced_cost(i, k), which FORI_VERIFICATION uses to fix x_ik to zero before the MIP
+         */
+        [[nodiscard]] double node_reduced_cost(int i, int k) const { return best_node_rc_[i * n_h() + k]; }
+};
+
+#endif //GEDC_LAGRANGIAN_BOUND_HPP
@@ -0,0 +1,32 @@
+#ifndef GEDC_MEMORY_HPP
+#define GEDC_MEMORY_HPP
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * process memory statistics for the verification output. allocations() counts the calls of the global operator new,
+ * which src/utils/allocation_counter.cpp replaces. That file is linked into the executables only, not into the
+ * similarity_search library, so in other programs allocations() stays 0.
+ */
+namespace memory {
+
+        /// incremented by the operator new of allocation_counter.cpp
+        extern std::atomic<std::size_t> allocation_counter;
+
+        /// @brief number of global operator new calls since program start
+        std::size_t allocations();
+
+        /// @brief starts a new peak_rss_kb() at the current resident set size, e.g. per query (linux only, elsewhere the
+        /// peak stays the one of the process)
+        void reset_peak_rss();
+
+        /// @brief peak resident set size of the process in KB since the last reset_peak_rss()
+        long peak_rss_kb();
+
+        /// @brief current resident set size of the process in KB, 0 if the platform does not report it
+        long current_rss_kb();
+
+} // namespace memory
+
+#endif //GEDC_MEMORY_HPP
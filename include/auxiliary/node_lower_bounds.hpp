@@ -0,0 +1,75 @@
+#ifndef GEDC_NODE_LOWER_BOUNDS_HPP
+#define GEDC_NODE_LOWER_BOUNDS_HPP
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "verification_arena.hpp"
+
+/**
+ * adds to arena.node_lb[a][b] (or [b][a] if transposed) a lower bound on the cost of the other nodes of one side
+ * when a is substituted by b: every other node a' is removed or substituted by some node other than b, so it costs
+ * at least min(remove[a'], cheapest substitution of a' avoiding b). The sum over all a' plus a correction for the
+ * nodes whose cheapest partner is b is computed once, so the bound of all pairs takes O(n_a n_b).
+ */
+template<typename Cost>
+void add_side_floor(verification_arena &arena, int n_a, int n_b, Cost cost, const std::vector<double> &remove, bool transposed) {
+        auto &keep = arena.floor_keep;
+        auto &next = arena.floor_next;
+        auto &corr = arena.floor_corr;
+        auto &arg = arena.floor_arg;
+        keep.assign(n_a, 0.0);
+        next.assign(n_a, 0.0);
+        arg.assign(n_a, -1);
+        corr.assign(n_b, 0.0);
+        double total = 0.0;
+        for (int a = 0; a < n_a; a++) {
+                double best = std::numeric_limits<double>::infinity();
+                double second = best;
+                for (int b = 0; b < n_b; b++) {
+                        double c = cost(a, b);
+                        if (c < best) {
+                                second = best;
+                                best = c;
+                                arg[a] = b;
+                        } else if (c < second) {
+                                second = c;
+                        }
+                }
+                keep[a] = std::min(remove[a], best);
+                next[a] = std::min(remove[a], second);
+                total += keep[a];
+                if (arg[a] >= 0 and next[a] != keep[a]) {
+                        corr[arg[a]] += next[a] - keep[a];
+                }
+        }
+        auto &lb = arena.node_lb.rows;
+        for (int a = 0; a < n_a; a++) {
+                for (int b = 0; b < n_b; b++) {
+                        double floor = total + corr[b] - (arg[a] == b ? next[a] : keep[a]);
+                        double &entry = transposed ? lb[b][a] : lb[a][b];
+                        entry = std::max(entry, floor);
+                }
+        }
+}
+
+/**
+ * sparse model: costs are not negative, so an edit path that substitutes i by k costs at least c_ik plus the floor
+ * of the other nodes of G, or of H, whichever is larger. If that exceeds the threshold, x_ik is zero in every
+ * solution <= threshold and is not generated. The relative cost c_ik - c_ie - c_ek of the objective can not be used
+ * for this, the other pairs can save more than it costs. The bounds end up in arena.node_lb.
+ */
+inline void node_lower_bounds(verification_arena &arena, int n_g, int n_h, const std::vector<std::vector<double>> &c_ik,
+                              const std::vector<double> &c_ie, const std::vector<double> &c_ek) {
+        arena.node_lb.reshape(n_g, n_h, 0.0);
+        add_side_floor(arena, n_g, n_h, [&c_ik](int i, int k) { return c_ik[i][k]; }, c_ie, false);
+        add_side_floor(arena, n_h, n_g, [&c_ik](int k, int i) { return c_ik[i][k]; }, c_ek, true);
+        for (int i = 0; i < n_g; i++) {
+                for (int k = 0; k < n_h; k++) {
+                        arena.node_lb.rows[i][k] += c_ik[i][k];
+                }
+        }
+}
+
+#endif //GEDC_NODE_LOWER_BOUNDS_HPP
@@ -11,6 +11,8 @@ public:
         std::string solutionFilePath_;
         std::string dataset_name_;
         std::string formulation_name_;
+        /// MIP backend of the verification ILP, see solver::make_solver
+        std::string solver_backend_ = "gurobi";
         std::string output_fname_;
         std::string output_lpfile_;
         std::string log_fname_;
@@ -27,14 +29,18 @@ public:
         std::string H_num_edges_;
         bool relaxed_ = false;
         int threads_ = 1;
+        /// verification ILPs solved concurrently (gurobi/verification_pool.hpp), each with max(1, threads_ / workers_) solver threads
+        int workers_ = 1;
+        /// pairs of the current query that a worker stole from the queue of another one
+        int steals_ = 0;
         std::string Q_filename_;
         std::string Q_id_;
         std::string Q_num_nodes_;
         std::string Q_num_edges_;
         /// setting for different branching priorities
         int setting_ = 0;               // soon deprecated branch priority setting only for pop formulations,
-        int branchPrio_ = 0;            // branch priority setting
-        int branchDirection_ = 0;       // which direction to branch (to 0 or to 1, look at the executables/setBranchPriority() for which direction is which)
+        int branchPrio_ = 0;            // branch priority setting (0 none, 1 nodes first, 2 label rarity, 3 fractional degree, 4 objective coefficient)
+        int branchDirection_ = 0;       // which direction to branch (0 solver default, 1 down to 0, 2 up to 1, 3 hint the heuristic mapping)
         bool includeObjCoefIntoFracDegreeBranch = false;  // should the obj function coefficient be included as tiebreak when two variables have same fractional degree
         int seed_ = 0;
         int n_vars_full_ = 0;
@@ -60,6 +66,33 @@ public:
         bool addC2F2_ = false;
         bool addC3_ = false;
         bool addC3onlySub_ = false;
+        /// root bound and branch-and-bound nodes, for every pair that needed gurobi
+        std::vector<double> root_bounds;
+        std::vector<double> bb_nodes;
+        /// sparse model: x_ik is not generated if substituting i by k alone makes every edit path exceed the threshold
+        bool sparse_variables_ = true;
+        /// solver_profile file written by tune_verification ("" for the built-in settings)
+        std::string solver_profile_path_;
+        /// dataset snapshot written by convert_snapshot ("" to parse the GXL files) and seconds spent loading the dataset
+        std::string snapshot_path_;
+        double dataset_load_time_ = 0.0;
+        /// seconds of the filter pass that computes the cheap lower bounds of all queries against the database at once
+        double filter_time_ = 0.0;
+        /// zip archive the dataset was parsed from ("" if it was read from a snapshot or the extracted folder)
+        std::string archive_path_;
+        /// bound_cache file shared between runs ("" to disable) and number of pairs of the current query it decided
+        std::string bound_cache_path_;
+        int decided_by_cache_ = 0;
+        /// decision mode: a feasibility and a bound focused copy of the model race, race_winner_ is 0 or 1 for the copy that
+        /// decided and -1 if the pair was not raced or neither copy decided
+        bool race_ = false;
+        int race_winner_ = -1;
+        std::vector<int> race_winners;
+        /// block-diagonal batches of tiny verification models: at most batch_size_ pairs (0 or 1: no batching) and
+        /// batch_vars_ variables per solve, batch_sizes holds the number of pairs of every batch solve
+        int batch_size_ = 0;
+        int batch_vars_ = 20000;
+        std::vector<int> batch_sizes;
         bool disablePresolving = false;
         bool disableSymmetry = false;
         bool Reoptimize_ = false;
@@ -68,6 +101,20 @@ public:
         double ILP_lprelval = -1.0;
         double ILP_lpreltime = -1.0;
         double threshold = 1;
+        /// sweep mode: all thresholds of the run in ascending order, threshold is the largest one. For every candidate of
+        /// graphlist, candidate_cheap is the best lower bound known before the ILP, candidate_lower/upper the final proven
+        /// bounds on its GED (upper is max if unknown) and candidate_ilp whether it reached the ILP
+        std::vector<double> thresholds;
+        std::vector<double> candidate_cheap;
+        std::vector<double> candidate_lower;
+        std::vector<double> candidate_upper;
+        std::vector<int> candidate_ilp;
+        /// top-k mode: number of nearest graphs the last query searched for (0: range query). accepted_graphs then holds them
+        /// by increasing distance, nearest_distances their GED and nearest_exact whether it is exact or only an upper bound
+        int top_k_ = 0;
+        std::vector<double> nearest_distances;
+        std::vector<int> nearest_exact;
+        std::vector<std::string> ilp_pairs;
         int     size = 1000;
         std::vector<uint32_t> verification_times;
         std::vector<std::string> accepted_graphs;
@@ -77,10 +124,36 @@ public:
         std::vector<double> upperbounds;
         bool    flat;
         bool    preprocessing_ = false;
+        /// uniform edit costs instead of the dataset's cost model, also selects the cost model of GEDLIB, bound_cache and solver_profile
+        bool    uniform_costs_ = false;
         bool    heuristic_ = false;
         std::vector<uint32_t> preprocessing_times_;
         std::vector<uint32_t> gurobi_times_;
         int     accepted_by_heuristic_ = 0;
+        /// if the ILP should be warm started from the node map of the GEDLIB upper bound
+        bool    warmstart_ = false;
+        /// if node variables should be fixed with the reduced costs of the Lagrangian bound before the MIP is solved, and the
+        /// edge variables of a fixed node pair with them. The bound is computed for this even without lagrangian_, it then
+        /// does not reject pairs
+        bool    reduced_cost_fixing_ = true;
+        int     vars_fixed_ = 0;
+        std::vector<int> vars_fixed;
+        /// size of the verification model and time until its root relaxation was solved, for every pair that needed gurobi
+        std::vector<int> model_vars;
+        std::vector<int> model_constrs;
+        std::vector<double> lp_times;
+        /// Lagrangian bound (auxiliary/lagrangian_bound.hpp) as rejection stage before the LP relaxation
+        bool    lagrangian_ = true;
+        int     lagrangian_iterations_ = 30;
+        double  lagrangian_bound_ = 0.0;
+        double  lagrangian_time_ = 0.0;
+        int     rejected_by_lagrangian_ = 0;
+        std::vector<double> lagrangian_bounds;
+        std::vector<double> lagrangian_times;
+        /// memory of the process after a query, see auxiliary/memory.hpp
+        long peak_rss_kb_ = 0;
+        long rss_kb_ = 0;
+        std::size_t allocations_ = 0;
         int linearRelaxation_ = 0;
         bool gurobi_presolve_ = true;
         bool gurobi_only_LP_ = false;
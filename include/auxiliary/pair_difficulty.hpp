@@ -0,0 +1,24 @@
+#ifndef GEDC_PAIR_DIFFICULTY_HPP
+#define GEDC_PAIR_DIFFICULTY_HPP
+
+#include <algorithm>
+
+/**
+ * estimated cost of the verification ILP of a pair with vars variables, only used to order the schedule of
+ * verification_pool: the ILP is hardest when the threshold lies between the bounds known before it and close to one of
+ * them. A threshold outside [lower, upper] is decided from the side of the nearer bound, the farther away the easier.
+ * The result is positive and finite for any bounds, including an unknown upper bound of std::numeric_limits<double>::max().
+ */
+inline double pair_difficulty(double vars, double lower, double upper, double threshold) {
+        double gap;
+        if (threshold < lower) {
+                gap = lower - threshold;
+        } else if (threshold > upper) {
+                gap = threshold - upper;
+        } else {
+                gap = std::min(threshold - lower, upper - threshold);
+        }
+        return (1.0 + std::max(0.0, vars)) / (1.0 + gap);
+}
+
+#endif //GEDC_PAIR_DIFFICULTY_HPP
@@ -0,0 +1,61 @@
+#ifndef GEDC_SOLVER_PROFILE_HPP
+#define GEDC_SOLVER_PROFILE_HPP
+
+#include <string>
+#include <vector>
+
+#include "solver/MIPSolver.hpp"
+
+/**
+ * solver parameters per model size, written by tune_verification and applied by FORI_VERIFICATION to every model it
+ * builds. A profile belongs to one context (dataset and cost model, e.g. "aids/uniform", as for the bound_cache). Its
+ * buckets are sorted by max_vars, a model uses the first bucket it fits into and models larger than every bucket use
+ * the last one. The file is JSON, so a profile can be inspected and edited by hand.
+ */
+class solver_profile {
+public:
+        struct setting {
+                solver::LpMethod method = solver::LpMethod::BARRIER;
+                /// -1 keeps the solver default
+                int presolve = -1;
+                int cuts = -1;
+                /// negative keeps the solver default
+                double heuristics = -1.0;
+                /// 0 keeps the threads of the run
+                int threads = 0;
+
+                /**
+                 * @brief sets the parameters that differ from the solver defaults on model
+                 * @param max_threads threads the model was given by the run (e.g. its share of a worker pool), the profile
+                 * only lowers them
+                 */
+                void apply(solver::MIPSolver &model, int max_threads) const;
+
+                [[nodiscard]] std::string str() const;
+        };
+
+        struct bucket {
+                /// models with at most this many variables (before sparse generation) use params
+                int max_vars = 0;
+                setting params;
+                /// tuning statistics: number of sampled pairs and their mean verification time with params
+                int pairs = 0;
+                double seconds = 0.0;
+        };
+
+        std::string context;
+        std::vector<bucket> buckets;
+
+        /// @throws std::runtime_error if the file can not be read or is not a profile
+        static solver_profile load(const std::string &path);
+
+        /// @throws std::runtime_error if the file can not be written
+        void save(const std::string &path) const;
+
+        /// @brief setting for a model with vars variables, nullptr if the profile is empty
+        [[nodiscard]] const setting *find(int vars) const;
+
+        [[nodiscard]] bool empty() const { return buckets.empty(); }
+};
+
+#endif //GEDC_SOLVER_PROFILE_HPP
@@ -0,0 +1,87 @@
+#ifndef GEDC_VERIFICATION_ARENA_HPP
+#define GEDC_VERIFICATION_ARENA_HPP
+
+#include <tuple>
+#include <vector>
+
+#include "solver/MIPSolver.hpp"
+
+/**
+ * matrix stored as a vector of rows, as expected by graph::cost_function. Rows that are not needed for the current
+ * shape are parked instead of freed, so reshaping to a size that was used before does not allocate.
+ */
+template<typename V>
+class arena_matrix {
+private:
+        std::vector<std::vector<V>> spare_;
+
+public:
+        std::vector<std::vector<V>> rows;
+
+        void reshape(std::size_t n_rows, std::size_t n_cols, V value) {
+                while (rows.size() > n_rows) {
+                        spare_.push_back(std::move(rows.back()));
+                        rows.pop_back();
+                }
+                while (rows.size() < n_rows) {
+                        if (spare_.empty()) {
+                                rows.emplace_back();
+                        } else {
+                                rows.push_back(std::move(spare_.back()));
+                                spare_.pop_back();
+                        }
+                }
+                for (auto &row: rows) {
+                        row.assign(n_cols, value);
+                }
+        }
+};
+
+/**
+ * per-pair buffers of the verification models. One arena lives as long as its FORI_VERIFICATION object, the buffers
+ * only grow, so that a sweep over a whole database stops allocating once the largest pair has been seen.
+ */
+struct verification_arena {
+        arena_matrix<double> c_ik;
+        arena_matrix<double> c_ijkl;
+        std::vector<double> c_ie;
+        std::vector<double> c_ek;
+        std::vector<double> c_ije;
+        std::vector<double> c_ekl;
+
+        /// variable indices in the solver::MIPSolver, edge_sub_rev has no rows for FORI-COMPACT
+        arena_matrix<int> node_sub;
+        arena_matrix<int> edge_sub;
+        arena_matrix<int> edge_sub_rev;
+        arena_matrix<bool> node_fixed;
+
+        /// lower bound on the cost of every edit path with i -> k, and the per node scratch space to compute it
+        arena_matrix<double> node_lb;
+        std::vector<double> floor_keep;
+        std::vector<double> floor_next;
+        std::vector<double> floor_corr;
+        std::vector<int> floor_arg;
+
+        solver::LinExpr objfunc;
+        solver::LinExpr row;
+
+        /// (key, tiebreak, variable) of the x variables, sorted to derive branching priorities
+        std::vector<std::tuple<double, double, int>> branch_order;
+
+        void reshape(std::size_t n_g, std::size_t n_h, std::size_t m_g, std::size_t m_h, bool compact) {
+                c_ik.reshape(n_g, n_h, 0.0);
+                c_ijkl.reshape(m_g, m_h, 0.0);
+                c_ie.assign(n_g, 0.0);
+                c_ek.assign(n_h, 0.0);
+                c_ije.assign(m_g, 0.0);
+                c_ekl.assign(m_h, 0.0);
+                node_sub.reshape(n_g, n_h, -1);
+                edge_sub.reshape(m_g, m_h, -1);
+                edge_sub_rev.reshape(compact ? 0 : m_g, m_h, -1);
+                objfunc.clear();
+                row.clear();
+                branch_order.clear();
+        }
+};
+
+#endif //GEDC_VERIFICATION_ARENA_HPP
@@ -0,0 +1,81 @@
+#ifndef GEDC_WORKER_POOL_HPP
+#define GEDC_WORKER_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * fixed set of threads that run the iterations of a loop concurrently. run(count, body, cost) calls body(worker, i) once
+ * for every i < count. worker lies in [0, size()) and no two calls with the same worker overlap, so per-worker state can
+ * be indexed by it without locking. The calling thread is worker 0, the other threads are started once and sleep between
+ * runs.
+ *
+ * Scheduling is work stealing over an estimated cost per iteration: the iterations are sorted by decreasing cost and each
+ * is dealt to the worker with the least cost so far (longest processing time first). A worker runs its own queue from the
+ * most expensive end; once it is empty it steals the most expensive open iteration of the worker with the most remaining
+ * cost. Expensive iterations thus start first and the cheap ones fill the gaps, which keeps the makespan close to the total
+ * cost divided by the number of workers even if the costs span orders of magnitude.
+ */
+class worker_pool {
+public:
+        /// @param workers number of concurrent workers, values below 1 are treated as 1 (run() then uses only the caller)
+        explicit worker_pool(int workers);
+
+        ~worker_pool();
+
+        worker_pool(const worker_pool &) = delete;
+
+        worker_pool &operator=(const worker_pool &) = delete;
+
+        [[nodiscard]] int size() const { return static_cast<int>(threads_.size()) + 1; }
+
+        /**
+         * calls body(worker, i) for every i < count and returns when all calls are done
+         * @param cost estimated cost of every iteration, empty: all iterations cost the same
+         * @throws the first exception thrown by body, the iterations nobody started yet are skipped
+         */
+        void run(std::size_t count, const std::function<void(int, std::size_t)> &body, const std::vector<double> &cost = {});
+
+        /// number of iterations the last run() executed on another worker than the one they were dealt to
+        [[nodiscard]] std::size_t steals() const { return steals_; }
+
+private:
+        /// iterations dealt to one worker, most expensive first, and their total cost
+        struct queue {
+                std::mutex mutex;
+                std::deque<std::size_t> tasks;
+                double remaining = 0.0;
+        };
+
+        std::vector<std::thread> threads_;
+        std::vector<std::unique_ptr<queue>> queues_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        /// incremented by every run(), a sleeping thread joins the run whose number it has not seen yet
+        std::size_t generation_ = 0;
+        /// threads that have not finished the current run
+        std::size_t busy_ = 0;
+        bool stop_ = false;
+        const std::function<void(int, std::size_t)> *body_ = nullptr;
+        std::vector<double> cost_;
+        std::atomic<std::size_t> steals_{0};
+        std::exception_ptr error_;
+
+        void loop(int worker);
+
+        void drain(int worker);
+
+        /// @brief takes the next iteration of the own queue, or steals one, false if every queue is empty
+        bool next(int worker, std::size_t &i);
+};
+
+#endif //GEDC_WORKER_POOL_HPP
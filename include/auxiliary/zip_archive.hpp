@@ -0,0 +1,52 @@
+#ifndef GEDC_ZIP_ARCHIVE_HPP
+#define GEDC_ZIP_ARCHIVE_HPP
+
+#include <cstdint>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/**
+ * read-only access to the zip archives the datasets are shipped in (data/AIDS/AIDSGXL.zip etc.). The whole archive is
+ * read with one sequential read and entries are inflated in memory with zlib, so loading a dataset does not need an
+ * extracted folder of thousands of small files. Stored and deflated entries are supported, zip64 and encryption are not.
+ */
+class zip_archive {
+public:
+        struct entry {
+                /// path inside the archive
+                std::string name;
+                /// 0 stored, 8 deflated
+                std::uint16_t method = 0;
+                std::uint32_t crc = 0;
+                std::uint64_t compressed_size = 0;
+                std::uint64_t size = 0;
+                std::uint64_t local_header_offset = 0;
+        };
+
+        /// @throws std::runtime_error if the file can not be read or is not a zip archive this class supports
+        explicit zip_archive(const std::string &path);
+
+        /// entries in the order of the central directory
+        [[nodiscard]] const std::vector<entry> &entries() const { return entries_; }
+
+        /// @brief decompressed contents of e
+        /// @throws std::runtime_error if the entry is corrupt (inflate error, size or CRC mismatch)
+        [[nodiscard]] std::string extract(const entry &e) const;
+
+private:
+        std::string path_;
+        std::string data_;
+        std::vector<entry> entries_;
+};
+
+/// istream buffer over memory that is owned elsewhere, GXLGraphReader::parse_* read extracted entries through it without a copy
+class memory_streambuf : public std::streambuf {
+public:
+        memory_streambuf(const char *data, std::size_t size) {
+                char *begin = const_cast<char *>(data);
+                setg(begin, begin, begin + size);
+        }
+};
+
+#endif //GEDC_ZIP_ARCHIVE_HPP
@@ -0,0 +1,114 @@
+#ifndef GEDC_DATASET_TRAITS_HPP
+#define GEDC_DATASET_TRAITS_HPP
+
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "auxiliary/GXLGraphReader.hpp"
+#include "auxiliary/graph.hpp"
+
+/// edit costs and method of GEDLIB for the preprocessing bounds and the warm start mapping
+enum class gedlib_cost_model {
+        /// CONSTANT with BRANCH_UNIFORM for uniform costs, CHEM_2 with BRANCH otherwise
+        chemical,
+        /// PROTEIN with BRANCH for either cost model of the ILP
+        protein
+};
+
+/**
+ * what SimilaritySearch needs to know of a dataset: label types, where the GXL files, the zip archive and the collection
+ * are, how a graph is parsed, the GEDLIB cost model and which queries a run uses by default. Paths are relative to the
+ * build directory, as the experiment scripts run the executables from there.
+ *
+ * folder lists the graphs of the dataset and is the fallback for queries that are not in the database, reader_folder is
+ * where the graphs are parsed from and gedlib_folder where GEDLIB loads the collection from.
+ */
+struct aids_traits {
+        using node_label = std::string;
+        using edge_label = int;
+
+        static constexpr const char *name = "aids";
+        static constexpr const char *folder = "../data/AIDS/";
+        static constexpr const char *reader_folder = "../data/AIDS/";
+        static constexpr const char *gedlib_folder = "../data/AIDS/";
+        static constexpr const char *archive = "../data/AIDS/AIDSGXL.zip";
+        static constexpr const char *collection = "../data/collections/allAIDS.xml";
+        static constexpr gedlib_cost_model costs = gedlib_cost_model::chemical;
+        /// the label and degree counting bound of filter_tiles.hpp runs before the edit costs of a pair are computed
+        static constexpr bool cheap_filter = true;
+        /// node range of randomly selected queries
+        static constexpr std::uint32_t query_min_nodes = 15;
+        static constexpr std::uint32_t query_max_nodes = std::numeric_limits<std::uint32_t>::max();
+
+        static std::vector<std::string> irrelevant_attributes() { return {"x", "y", "symbol", "charge"}; }
+
+        /// the queries of the paper, empty to select random ones
+        static std::vector<std::string> default_queries() {
+                return {"20074.gxl", "42414.gxl", "33010.gxl", "27115.gxl", "435.gxl", "41217.gxl", "15750.gxl", "32612.gxl", "21643.gxl", "38188.gxl"};
+        }
+
+        static graph<node_label, edge_label> read(const std::string &path) { return GXLGraphReader::read_AIDS(path); }
+
+        static graph<node_label, edge_label> parse(std::istream &in) { return GXLGraphReader::parse_AIDS(in); }
+};
+
+struct muta_traits {
+        using node_label = std::string;
+        using edge_label = int;
+
+        static constexpr const char *name = "muta";
+        static constexpr const char *folder = "../data/Mutagenicity/";
+        static constexpr const char *reader_folder = "../data/Mutagenicity/";
+        static constexpr const char *gedlib_folder = "../data/Mutagenicity/";
+        static constexpr const char *archive = "../data/Mutagenicity/MutaGXL.zip";
+        static constexpr const char *collection = "../data/collections/allMutagenicity.xml";
+        static constexpr gedlib_cost_model costs = gedlib_cost_model::chemical;
+        static constexpr bool cheap_filter = true;
+        static constexpr std::uint32_t query_min_nodes = 10;
+        static constexpr std::uint32_t query_max_nodes = 75;
+
+        static std::vector<std::string> irrelevant_attributes() { return {"x", "y", "symbol", "charge"}; }
+
+        static std::vector<std::string> default_queries() {
+                return {"molecule_356.gxl", "molecule_508.gxl", "molecule_973.gxl", "molecule_1578.gxl", "molecule_1907.gxl", "molecule_2897.gxl",
+                        "molecule_3184.gxl", "molecule_3322.gxl", "molecule_3410.gxl", "molecule_4116.gxl"};
+        }
+
+        static graph<node_label, edge_label> read(const std::string &path) { return GXLGraphReader::read_mutagenicity(path); }
+
+        static graph<node_label, edge_label> parse(std::istream &in) { return GXLGraphReader::parse_mutagenicity(in); }
+};
+
+struct protein_traits {
+        using node_label = std::pair<int, std::string>;
+        using edge_label = std::tuple<int, int, int>;
+
+        static constexpr const char *name = "protein";
+        static constexpr const char *folder = "../data/Protein/";
+        /// the GED copy of the dataset, its files carry the labels the edit costs are defined on
+        static constexpr const char *reader_folder = "../data/Protein-GED/Protein/";
+        static constexpr const char *gedlib_folder = "../data/Protein";
+        /// no archive: ProteinGXL.zip holds the files of folder, not those of reader_folder, so the folder is read
+        static constexpr const char *archive = "";
+        static constexpr const char *collection = "../data/collections/allProtein.xml";
+        static constexpr gedlib_cost_model costs = gedlib_cost_model::protein;
+        /// label mismatches of proteins cost more than one edit, every pair goes to the edit costs and GEDLIB directly
+        static constexpr bool cheap_filter = false;
+        static constexpr std::uint32_t query_min_nodes = 0;
+        static constexpr std::uint32_t query_max_nodes = std::numeric_limits<std::uint32_t>::max();
+
+        static std::vector<std::string> irrelevant_attributes() { return {"aaLength"}; }
+
+        static std::vector<std::string> default_queries() { return {}; }
+
+        static graph<node_label, edge_label> read(const std::string &path) { return GXLGraphReader::read_Proteins(path); }
+
+        static graph<node_label, edge_label> parse(std::istream &in) { return GXLGraphReader::parse_Proteins(in); }
+};
+
+#endif //GEDC_DATASET_TRAITS_HPP
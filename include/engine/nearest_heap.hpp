@@ -0,0 +1,69 @@
+#ifndef GEDC_NEAREST_HEAP_HPP
+#define GEDC_NEAREST_HEAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// one of the nearest graphs of SimilaritySearch::top_k()
+struct nearest_graph {
+        std::string file;
+        /// GED to the query, only an upper bound on it if exact is false (the ILP ran into the time limit)
+        double distance = 0.0;
+        bool exact = true;
+};
+
+/**
+ * the k nearest graphs of a top-k search within radius found so far, as a max-heap with the k-th nearest on top. The
+ * search visits the candidates by increasing lower bound and stops at the first one whose bound no longer beats() the
+ * heap; cap() is the threshold the ILP of the next candidate needs.
+ */
+class nearest_heap {
+public:
+        nearest_heap(std::size_t k, double radius) : k_(k), radius_(radius) { heap_.reserve(k); }
+
+        /// @brief the radius until k graphs are known, the distance of the k-th nearest afterwards
+        [[nodiscard]] double cap() const { return full() ? heap_.front().distance : radius_; }
+
+        /// @brief whether a candidate with this lower bound on its distance could still enter the heap
+        [[nodiscard]] bool beats(double lower) const {
+                if (k_ == 0) {
+                        return false;
+                }
+                return full() ? lower < heap_.front().distance - 1e-9 : lower <= radius_ + 1e-9;
+        }
+
+        /// @brief adds the graph if it beats() the heap, the k-th nearest drops out then
+        void offer(const std::string &file, double distance, bool exact) {
+                if (!beats(distance)) {
+                        return;
+                }
+                if (full()) {
+                        std::pop_heap(heap_.begin(), heap_.end(), farther);
+                        heap_.pop_back();
+                }
+                heap_.push_back({file, distance, exact});
+                std::push_heap(heap_.begin(), heap_.end(), farther);
+        }
+
+        [[nodiscard]] std::size_t size() const { return heap_.size(); }
+
+        /// @brief the graphs nearest first, ties in no particular order; the heap is empty afterwards
+        std::vector<nearest_graph> take_sorted() {
+                std::sort_heap(heap_.begin(), heap_.end(), farther);
+                return std::move(heap_);
+        }
+
+private:
+        std::size_t k_;
+        double radius_;
+        std::vector<nearest_graph> heap_;
+
+        [[nodiscard]] bool full() const { return heap_.size() >= k_; }
+
+        static bool farther(const nearest_graph &a, const nearest_graph &b) { return a.distance < b.distance; }
+};
+
+#endif //GEDC_NEAREST_HEAP_HPP
@@ -0,0 +1,30 @@
+#ifndef GEDC_SEARCH_CLI_HPP
+#define GEDC_SEARCH_CLI_HPP
+
+#include <string>
+
+#include "auxiliary/cxxopts.hpp"
+#include "auxiliary/options.hpp"
+#include "engine/dataset_traits.hpp"
+
+/// @brief adds the options of the search itself (formulation, solver, stages, dataset files) to opts
+/// @param archive default of --archive, the zip archive shipped with the dataset
+void add_search_options(cxxopts::Options &opts, const std::string &archive);
+
+/// @brief the options of the search from a command line parsed with add_search_options(), --archive is left to the caller
+/// @throws std::runtime_error for a branching setting out of range
+options parse_search_options(const cxxopts::ParseResult &arguments);
+
+/**
+ * command line front-end of SimilaritySearch<Traits>: parses the options of a prepro_verification run, searches the
+ * built-in, random or listed queries and writes one JSON output per query and threshold
+ * @return exit code of the executable
+ */
+template<typename Traits>
+int similarity_search_main(int argc, char **argv);
+
+extern template int similarity_search_main<aids_traits>(int argc, char **argv);
+extern template int similarity_search_main<muta_traits>(int argc, char **argv);
+extern template int similarity_search_main<protein_traits>(int argc, char **argv);
+
+#endif //GEDC_SEARCH_CLI_HPP
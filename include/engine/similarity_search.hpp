@@ -0,0 +1,108 @@
+#ifndef GEDC_SIMILARITY_SEARCH_HPP
+#define GEDC_SIMILARITY_SEARCH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "auxiliary/graph.hpp"
+#include "auxiliary/graph_database.hpp"
+#include "auxiliary/options.hpp"
+#include "engine/dataset_traits.hpp"
+#include "engine/nearest_heap.hpp"
+
+/// hooks of a single query, see SimilaritySearch::query()
+struct query_control {
+        /// polled between two pairs, once it returns true the query stops and drops the pairs it queued for the ILP
+        std::function<bool()> cancelled;
+        /// called with the file of every accepted database graph as soon as it is decided
+        std::function<void(const std::string &)> accepted;
+};
+
+/**
+ * graph similarity search on one dataset: the cheap lower bounds, the bound cache, the GEDLIB bounds and the verification
+ * ILP for every pair of a query and a database graph, as run by the prepro_verification executables. The dataset, the
+ * collection registry and GEDLIB are loaded once by the constructor, so a process can embed one engine and search any
+ * number of query sets with it.
+ *
+ * Like FORI_VERIFICATION the engine is bound to an options object: its settings are read by every search() and the
+ * results of a query are written to it. The GEDLIB environment is built here and not in the header, so embedding
+ * processes only need the headers of include/ and the similarity_search library.
+ */
+template<typename Traits>
+class SimilaritySearch {
+public:
+        using node_label = typename Traits::node_label;
+        using edge_label = typename Traits::edge_label;
+        using Database = GraphDatabase<node_label, edge_label>;
+        /// called once per query, the options of the engine then hold its results (see IO::create_verification_output)
+        using query_callback = std::function<void(const options &)>;
+
+        /**
+         * loads the dataset from opt.snapshot_path_, the zip archive or the GXL folder of Traits, the collection, GEDLIB,
+         * opt.bound_cache_path_ and opt.solver_profile_path_
+         * @param archive zip archive of the GXL files, "" or a missing file reads the extracted folder
+         * @throws std::runtime_error if a file can not be read or the solver profile was tuned for another dataset
+         */
+        SimilaritySearch(options &opt, const std::string &archive);
+
+        ~SimilaritySearch();
+
+        SimilaritySearch(const SimilaritySearch &) = delete;
+
+        SimilaritySearch &operator=(const SimilaritySearch &) = delete;
+
+        [[nodiscard]] const Database &database() const;
+
+        /// @brief the built-in queries of Traits, or count random database graphs with the node range of Traits
+        [[nodiscard]] std::vector<std::string> default_queries(std::size_t count, int seed) const;
+
+        /**
+         * verifies every query against every database graph at opt.thresholds, opt.threshold being the largest. All
+         * queries are filtered against the database in one pass first, then they are verified one after the other.
+         * @throws std::runtime_error if a query is not listed in the collection of Traits
+         */
+        void search(const std::vector<std::string> &queries, const query_callback &on_query);
+
+        /**
+         * verifies one graph of the collection against the database at threshold, the options of the engine then hold
+         * its results. The engine is not thread-safe, callers that share it have to serialize their queries.
+         * @return false if control.cancelled stopped the query, the results then only cover the pairs decided so far
+         * @throws std::runtime_error if file is not listed in the collection of Traits
+         */
+        bool query(const std::string &file, double threshold, const query_control &control = {});
+
+        /**
+         * verifies a graph that is not part of the collection, e.g. parsed from a request. GEDLIB holds no copy of it and
+         * the bound cache no bounds, so the pairs skip both stages and go from the cheap filter to the ILP.
+         * @param name reported as the query id of the results
+         */
+        bool query(graph<node_label, edge_label> query_graph, const std::string &name, double threshold, const query_control &control = {});
+
+        /**
+         * top-k mode: the k graphs of the database nearest to a graph of the collection, at a GED of at most radius. The
+         * candidates are visited by increasing lower bound and only verified while their bound beats the k-th nearest
+         * graph found so far, whose distance then caps the ILP. control.accepted is not called, the options of the engine
+         * hold the results of the candidates that were visited and accepted_graphs the nearest ones.
+         * @param nearest the nearest graphs by increasing distance, fewer than k if fewer are within radius
+         * @return false if control.cancelled stopped the search, nearest then only covers the candidates visited so far
+         * @throws std::runtime_error if file is not listed in the collection of Traits
+         */
+        bool top_k(const std::string &file, std::size_t k, double radius, std::vector<nearest_graph> &nearest, const query_control &control = {});
+
+        /// @brief top_k() for a graph that is not part of the collection, see query()
+        bool top_k(graph<node_label, edge_label> query_graph, const std::string &name, std::size_t k, double radius,
+                   std::vector<nearest_graph> &nearest, const query_control &control = {});
+
+private:
+        struct state;
+        std::unique_ptr<state> state_;
+};
+
+extern template class SimilaritySearch<aids_traits>;
+extern template class SimilaritySearch<muta_traits>;
+extern template class SimilaritySearch<protein_traits>;
+
+#endif //GEDC_SIMILARITY_SEARCH_HPP
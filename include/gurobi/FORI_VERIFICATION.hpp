@@ -1,12 +1,28 @@
 #ifndef GEDC_FORI_VERIFICATION_HPP
 #define GEDC_FORI_VERIFICATION_HPP
 
-#include "gurobi_c++.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include "auxiliary/bound_cache.hpp"
 #include "auxiliary/graph.hpp"
 #include "utils.hpp"
 
 #include "auxiliary/io.hpp"
+#include "auxiliary/lagrangian_bound.hpp"
+#include "auxiliary/node_lower_bounds.hpp"
 #include "auxiliary/options.hpp"
+#include "auxiliary/solver_profile.hpp"
+#include "auxiliary/verification_arena.hpp"
+#include "solver/solvers.hpp"
 
 template<typename T, typename U>
 class FORI_VERIFICATION {
@@ -15,313 +31,911 @@ private:
         bool testing_ = false;
         double constant_ = 0.0;
         bool relax_ = false;
-        char VAR_TYPE_ = GRB_BINARY;
         int threads_ = 1;
         int seed_ = 1;
+        std::vector<int> start_map_;
+        double start_objval_ = -1.0;
+        /// the last ged() proved GED > threshold (Lagrangian bound, infeasible or cut off model)
+        bool proven_greater_ = false;
+        verification_arena arena_;
+        /// solver environment of every model of this verifier, the bound focused copy of race() runs in its own
+        solver::environment env_;
+        solver::environment race_env_;
+        /// tuned solver parameters per model size, empty: the settings below are used for every model
+        solver_profile profile_;
+
+        /// block of the batch model: the objective of its pair over the batch variables and the slot variable
+        struct batch_block {
+                std::string tag;
+                int slot;
+                solver::LinExpr objfunc;
+                double constant;
+        };
+        std::unique_ptr<solver::MIPSolver> batch_model_;
+        std::vector<batch_block> batch_;
+        int batch_vars_ = 0;
+
+        /// var_matrix[a][b] is the index of the variable for the pair (a, b) in the solver::MIPSolver
+        using var_matrix = std::vector<std::vector<int>>;
+
+        /// @brief edge substitutions induced by the start mapping are only used if they are not more expensive than deletion plus insertion
+        inline bool use_induced_edge(int ij, int kl, const std::vector<std::vector<double>> &c_ijkl,
+                                     const std::vector<double> &c_ije, const std::vector<double> &c_ekl) const {
+                return c_ijkl[ij][kl] - c_ije[ij] - c_ekl[kl] <= 0;
+        }
 
-public:
+        /// @brief returns the index of the edge of H that is the image of edge ij of G under the start mapping, -1 if there is none
+        inline long induced_edge(graph<T, U> &G, graph<T, U> &H, int ij) const {
+                auto e = G.get_edge(ij);
+                int k = start_map_[e.first];
+                int l = start_map_[e.second];
+                if (k < 0 or l < 0 or not H.has_edge(k, l)) {
+                        return -1;
+                }
+                return H.get_edge_id(k, l);
+        }
 
-        FORI_VERIFICATION() = default;
+        /// @brief cost of the edit path induced by start_map_, computed with the same (relative) costs as the objective of the ILP
+        double mapping_cost(graph<T, U> &G, graph<T, U> &H,
+                            const std::vector<std::vector<double>> &c_ik, const std::vector<double> &c_ie, const std::vector<double> &c_ek,
+                            const std::vector<std::vector<double>> &c_ijkl, const std::vector<double> &c_ije, const std::vector<double> &c_ekl) const {
+                if (start_map_.size() != G.number_of_nodes()) {
+                        throw std::runtime_error("mapping_cost: start mapping has " + std::to_string(start_map_.size()) + " entries but G has " +
+                                                 std::to_string(G.number_of_nodes()) + " nodes");
+                }
+                double cost = 0.0;
+                for (double c: c_ie) cost += c;
+                for (double c: c_ek) cost += c;
+                for (double c: c_ije) cost += c;
+                for (double c: c_ekl) cost += c;
+
+                for (int i = 0; i < G.number_of_nodes(); i++) {
+                        int k = start_map_[i];
+                        if (k >= 0) {
+                                cost += c_ik[i][k] - c_ie[i] - c_ek[k];
+                        }
+                }
+                for (int ij = 0; ij < G.number_of_edges(); ij++) {
+                        auto kl = induced_edge(G, H, ij);
+                        if (kl >= 0 and use_induced_edge(ij, kl, c_ijkl, c_ije, c_ekl)) {
+                                cost += c_ijkl[ij][kl] - c_ije[ij] - c_ekl[kl];
+                        }
+                }
+                return cost;
+        }
 
-        explicit FORI_VERIFICATION(options &opt) : opt_(opt) {}
+        /// @brief sets the start value of every x and z variable consistently with start_map_, edge_sub_rev is empty for FORI-COMPACT
+        void set_mip_start(graph<T, U> &G, graph<T, U> &H, solver::MIPSolver &model, const var_matrix &node_sub, const var_matrix &edge_sub,
+                           const var_matrix &edge_sub_rev, const std::vector<std::vector<double>> &c_ijkl, const std::vector<double> &c_ije,
+                           const std::vector<double> &c_ekl) {
+                auto start = [&model](int var, double value) {
+                        if (var >= 0) {
+                                model.set_start(var, value);
+                        }
+                };
+                for (int i = 0; i < G.number_of_nodes(); i++) {
+                        for (int k = 0; k < H.number_of_nodes(); k++) {
+                                start(node_sub[i][k], start_map_[i] == k ? 1.0 : 0.0);
+                        }
+                }
+                for (int ij = 0; ij < G.number_of_edges(); ij++) {
+                        auto kl_match = induced_edge(G, H, ij);
+                        if (kl_match >= 0 and not use_induced_edge(ij, kl_match, c_ijkl, c_ije, c_ekl)) {
+                                kl_match = -1;
+                        }
+                        for (int kl = 0; kl < H.number_of_edges(); kl++) {
+                                double sub = 0.0;
+                                double sub_rev = 0.0;
+                                if (kl == kl_match) {
+                                        // edge_sub maps first->first, edge_sub_rev maps first->second
+                                        if (start_map_[G.get_edge(ij).first] == H.get_edge(kl).first) {
+                                                sub = 1.0;
+                                        } else {
+                                                sub_rev = 1.0;
+                                        }
+                                }
+                                if (edge_sub_rev.empty()) {
+                                        start(edge_sub[ij][kl], sub + sub_rev);
+                                        continue;
+                                }
+                                start(edge_sub[ij][kl], sub);
+                                start(edge_sub_rev[ij][kl], sub_rev);
+                        }
+                }
+        }
 
+        /**
+         * reduced cost fixing before the MIP: x_ik is zero in every solution <= threshold if bound + node_rc(i, k) exceeds
+         * the threshold. The reduced costs come from the Lagrangian relaxation, so no separate LP solve is needed. Edge
+         * variables whose end point assignment got fixed are fixed as well, so that only the reduced model is handed to
+         * branch-and-bound
+         * @return number of variables fixed to zero
+         */
+        template<typename NodeRC>
+        int fix_by_reduced_cost(graph<T, U> &G, graph<T, U> &H, solver::MIPSolver &model, const var_matrix &node_sub, const var_matrix &edge_sub,
+                                const var_matrix &edge_sub_rev, double bound, NodeRC node_rc) {
+                int fixed = 0;
+                auto fix = [&fixed, &model](int var) {
+                        if (var < 0) {
+                                return;
+                        }
+                        model.set_ub(var, 0.0);
+                        fixed++;
+                };
+
+                arena_.node_fixed.reshape(G.number_of_nodes(), H.number_of_nodes(), false);
+                auto &node_fixed = arena_.node_fixed.rows;
+                for (int i = 0; i < G.number_of_nodes(); i++) {
+                        for (int k = 0; k < H.number_of_nodes(); k++) {
+                                if (node_sub[i][k] < 0 or bound + node_rc(i, k) > opt_.threshold + 1e-6) {
+                                        node_fixed[i][k] = true;
+                                        fix(node_sub[i][k]);
+                                }
+                        }
+                }
+                for (int ij = 0; ij < G.number_of_edges(); ij++) {
+                        auto [i, j] = G.get_edge(ij);
+                        for (int kl = 0; kl < H.number_of_edges(); kl++) {
+                                auto [k, l] = H.get_edge(kl);
+                                if (edge_sub_rev.empty()) {
+                                        // compact variant: edge_sub[ij][kl] needs i->k and j->l, or i->l and j->k
+                                        if ((node_fixed[i][k] or node_fixed[j][l]) and (node_fixed[i][l] or node_fixed[j][k])) {
+                                                fix(edge_sub[ij][kl]);
+                                        }
+                                        continue;
+                                }
+                                // edge_sub maps i->k and j->l, edge_sub_rev maps i->l and j->k
+                                if (node_fixed[i][k] or node_fixed[j][l]) {
+                                        fix(edge_sub[ij][kl]);
+                                }
+                                if (node_fixed[i][l] or node_fixed[j][k]) {
+                                        fix(edge_sub_rev[ij][kl]);
+                                }
+                        }
+                }
+                return fixed;
+        }
 
-        inline void relax() {
-                relax_ = true;
-                opt_.relaxed_ = true;
+        /// @brief a topological row without edge variable only says -x <= 0, in a sparse model these rows are left out
+        static inline bool has_edge_term(const solver::LinExpr &le) {
+                return std::any_of(le.coefs.begin(), le.coefs.end(), [](double c) { return c > 0; });
         }
 
-        inline void set_testing() { testing_ = true; }
+        /// @brief FORI topological constraints: an oriented edge of G can only be mapped onto an oriented edge of H if its end points are mapped accordingly
+        void add_topological_constraints(graph<T, U> &G, graph<T, U> &H, solver::MIPSolver &model, const var_matrix &node_sub,
+                                         const var_matrix &edge_sub, const var_matrix &edge_sub_rev) {
+                auto n_g = G.number_of_nodes();
+                auto n_h = H.number_of_nodes();
+                auto m_g = G.number_of_edges();
+                auto m_h = H.number_of_edges();
 
-        inline void set_threads(int threads) { threads_ = threads; }
+                auto &le2 = arena_.row;
+                for (int ij = 0; ij < m_g; ij++) {
+                        for (int k = 0; k < n_h; k++) {
+                                le2.clear();
+                                le2.add(node_sub[G.get_edge(ij).first][k], -1.0);
+                                for (int kl = 0; kl < m_h; kl++) {
+                                        if (k == H.get_edge(kl).first) {
+                                                le2.add(edge_sub[ij][kl]);
+                                        }
+                                        else if(k == H.get_edge(kl).second) {
+                                                  le2.add(edge_sub_rev[ij][kl]);
+                                        }
+                                }
+                                if (!has_edge_term(le2)) {
+                                        continue;
+                                }
+                                model.add_constr(le2, solver::Sense::LESS_EQUAL, 0, "Topological_1_G(" + std::to_string(G.get_edge(ij).first) + "," +
+                                                                           std::to_string(G.get_edge(ij).second) + ")" + "_" + std::to_string(k));
+                        }
+                }
 
-        inline void set_seed(int seed) { seed_ = seed; }
+                for (int ij = 0; ij < m_g; ij++) {
+                        for (int k = 0; k < n_h; k++) {
+                                le2.clear();
+                                le2.add(node_sub[G.get_edge(ij).second][k], -1.0);
+                                for (int kl = 0; kl < m_h; kl++) {
+                                        if (k == H.get_edge(kl).first) {
+                                                le2.add(edge_sub_rev[ij][kl]);
+                                        }
+                                        else if(k == H.get_edge(kl).second) {
+                                                le2.add(edge_sub[ij][kl]);
+                                        }
+                                }
+                                if (!has_edge_term(le2)) {
+                                        continue;
+                                }
+                                model.add_constr(le2, solver::Sense::LESS_EQUAL, 0, "Topological_2_G_(" + std::to_string(G.get_edge(ij).first) + "," +
+                                                                           std::to_string(G.get_edge(ij).second) + ")" + "_" + std::to_string(k));
+                        }
+                }
 
-        std::string log_name_;
-        std::string output_fname_;
-        double timelimit_ = 0;
-        options &opt_;
+                for (int kl = 0; kl < m_h; kl++) {
+                  for (int i = 0; i < n_g; i++) {
+                          le2.clear();
+                    le2.add(node_sub[i][H.get_edge(kl).first], -1.0);
+                    for (int ij = 0; ij < m_g; ij++) {
+                      if (i == G.get_edge(ij).first) {
+                        le2.add(edge_sub[ij][kl]);
+                      }
+                      if (i == G.get_edge(ij).second) {
+                        le2.add(edge_sub_rev[ij][kl]);
+                      }
+                    }
+                          if (!has_edge_term(le2)) {
+                                  continue;
+                          }
+                          model.add_constr(le2, solver::Sense::LESS_EQUAL, 0, "Topological_H_(" + std::to_string(H.get_edge(kl).first) + "," +
+                                    std::to_string(H.get_edge(kl).second) + ")" + "_" +
+                                    std::to_string(i));
+                  }
+                }
 
+                for (int kl = 0; kl < m_h; kl++) {
+                        for (int i = 0; i < n_g; i++) {
+                                le2.clear();
+                                le2.add(node_sub[i][H.get_edge(kl).second], -1.0);
+                                for (int ij = 0; ij < m_g; ij++) {
+                                        if (i == G.get_edge(ij).first) {
+                                                le2.add(edge_sub_rev[ij][kl]);
+                                        }
+                                        if (i == G.get_edge(ij).second) {
+                                                le2.add(edge_sub[ij][kl]);
+                                        }
+                                }
+                                if (!has_edge_term(le2)) {
+                                        continue;
+                                }
+                                model.add_constr(le2, solver::Sense::LESS_EQUAL, 0, "Topological_H_(" + std::to_string(H.get_edge(kl).second) + "," +
+                                          std::to_string(H.get_edge(kl).first) + ")" + "_" +
+                                          std::to_string(i));
+                        }
+                }
+        }
 
+        /**
+         * topological constraints of the orientation-free compact variant (-f FORI-COMPACT): edge_sub[ij][kl] = 1 if the
+         * undirected edge ij of G is substituted by the undirected edge kl of H, in either orientation. For every edge ij and
+         * node k the edges of H incident to k can only be matched with ij if i or j is mapped onto k, and vice versa for the
+         * edges of G incident to i. This needs half of the edge variables and half of the topological constraints of FORI.
+         */
+        void add_compact_topological_constraints(graph<T, U> &G, graph<T, U> &H, solver::MIPSolver &model, const var_matrix &node_sub,
+                                                 const var_matrix &edge_sub) {
+                auto n_g = G.number_of_nodes();
+                auto n_h = H.number_of_nodes();
+                auto m_g = G.number_of_edges();
+                auto m_h = H.number_of_edges();
 
-        std::string ged(graph<T, U> &G, graph<T, U> &H) {
+                auto &le2 = arena_.row;
+                for (int ij = 0; ij < m_g; ij++) {
+                        auto [i, j] = G.get_edge(ij);
+                        for (int k = 0; k < n_h; k++) {
+                                le2.clear();
+                                le2.add(node_sub[i][k], -1.0);
+                                le2.add(node_sub[j][k], -1.0);
+                                for (int kl = 0; kl < m_h; kl++) {
+                                        if (k == H.get_edge(kl).first or k == H.get_edge(kl).second) {
+                                                le2.add(edge_sub[ij][kl]);
+                                        }
+                                }
+                                if (!has_edge_term(le2)) {
+                                        continue;
+                                }
+                                model.add_constr(le2, solver::Sense::LESS_EQUAL, 0, "Topological_G_(" + std::to_string(i) + "," +
+                                                                                    std::to_string(j) + ")" + "_" + std::to_string(k));
+                        }
+                }
 
-                auto n_g = G.number_of_nodes(); 
-                auto n_h = H.number_of_nodes(); 
-                auto m_g = G.number_of_edges(); 
-                auto m_h = H.number_of_edges();
+                for (int kl = 0; kl < m_h; kl++) {
+                        auto [k, l] = H.get_edge(kl);
+                        for (int i = 0; i < n_g; i++) {
+                                le2.clear();
+                                le2.add(node_sub[i][k], -1.0);
+                                le2.add(node_sub[i][l], -1.0);
+                                for (int ij = 0; ij < m_g; ij++) {
+                                        if (i == G.get_edge(ij).first or i == G.get_edge(ij).second) {
+                                                le2.add(edge_sub[ij][kl]);
+                                        }
+                                }
+                                if (!has_edge_term(le2)) {
+                                        continue;
+                                }
+                                model.add_constr(le2, solver::Sense::LESS_EQUAL, 0, "Topological_H_(" + std::to_string(k) + "," +
+                                                                                    std::to_string(l) + ")" + "_" + std::to_string(i));
+                        }
+                }
+        }
 
-                try {
-                        GRBEnv *env;
-                        GRBVar **node_sub = new GRBVar*[n_g];
+        /**
+         * branching priorities of the x variables (branchPrio_), edge variables keep priority 0 and follow their endpoints:
+         * 1: node variables before edge variables
+         * 2: label rarity, x_ik first if few nodes of H carry the label of i
+         * 3: fractional degree, x_ik first if row i and column k keep many candidates that the Lagrangian bound could not fix
+         * 4: objective coefficient, cheapest substitutions first
+         * includeObjCoefIntoFracDegreeBranch breaks ties of 2 and 3 by the objective coefficient.
+         * branchDirection_: 1 down branch first, 2 up branch first, 3 hint the heuristic mapping (needs --warmStart)
+         */
+        template<typename NodeRC>
+        void set_branching(graph<T, U> &G, graph<T, U> &H, solver::MIPSolver &model, const var_matrix &node_sub,
+                           const std::vector<std::vector<double>> &c_ik, const std::vector<double> &c_ie, const std::vector<double> &c_ek,
+                           double bound, NodeRC node_rc) {
+                int n_g = G.number_of_nodes();
+                int n_h = H.number_of_nodes();
+                if (opt_.branchDirection_ == 1 or opt_.branchDirection_ == 2) {
+                        model.set_branch_direction(opt_.branchDirection_ == 1 ? -1 : 1);
+                } else if (opt_.branchDirection_ == 3 and !start_map_.empty()) {
                         for (int i = 0; i < n_g; i++) {
-                                node_sub[i] = new GRBVar[n_h];
+                                for (int k = 0; k < n_h; k++) {
+                                        if (node_sub[i][k] >= 0) {
+                                                model.set_branch_hint(node_sub[i][k], start_map_[i] == k ? 1.0 : 0.0);
+                                        }
+                                }
                         }
-                        GRBVar **edge_sub = new GRBVar*[m_g];
-                        for (int i = 0; i < m_g; i++) {
-                                edge_sub[i] = new GRBVar[m_h];
+                }
+                if (opt_.branchPrio_ == 0) {
+                        return;
+                }
+
+                std::map<T, int> label_count;
+                std::vector<int> row_open(n_g, 0), col_open(n_h, 0);
+                if (opt_.branchPrio_ == 2) {
+                        for (int k = 0; k < n_h; k++) {
+                                label_count[H.get_node_label(k)]++;
                         }
-                        GRBVar **edge_sub_rev = new GRBVar*[m_g];
-                        for (int i = 0; i < m_g; i++) {
-                                edge_sub_rev[i] = new GRBVar[m_h];
+                } else if (opt_.branchPrio_ == 3) {
+                        for (int i = 0; i < n_g; i++) {
+                                for (int k = 0; k < n_h; k++) {
+                                        if (bound + node_rc(i, k) <= opt_.threshold + 1e-6) {
+                                                row_open[i]++;
+                                                col_open[k]++;
+                                        }
+                                }
                         }
+                }
 
-                        env = new GRBEnv();
-                        GRBModel *model = new GRBModel(*env);
-                        model->set(GRB_StringAttr_ModelName, "FORI_VERIFICATION_"+opt_.dataset_name_ + "_"+opt_.G_id_ + "_" +opt_.H_id_);
-                        model->set(GRB_StringParam_LogFile, opt_.log_fname_ + ".log");
-                        model->set(GRB_IntParam_Threads, opt_.threads_);
+                auto &order = arena_.branch_order;
+                order.clear();
+                for (int i = 0; i < n_g; i++) {
+                        for (int k = 0; k < n_h; k++) {
+                                if (node_sub[i][k] < 0) {
+                                        continue;
+                                }
+                                double obj = c_ik[i][k] - c_ie[i] - c_ek[k];
+                                double key = 0.0;
+                                if (opt_.branchPrio_ == 2) {
+                                        auto it = label_count.find(G.get_node_label(i));
+                                        key = -(it == label_count.end() ? 0 : it->second);
+                                } else if (opt_.branchPrio_ == 3) {
+                                        key = row_open[i] + col_open[k];
+                                } else if (opt_.branchPrio_ == 4) {
+                                        key = -obj;
+                                }
+                                double tiebreak = opt_.includeObjCoefIntoFracDegreeBranch ? -obj : 0.0;
+                                order.emplace_back(key, tiebreak, node_sub[i][k]);
+                        }
+                }
+                // ascending order, equal keys share a priority, every x variable ends up above the edge variables
+                std::sort(order.begin(), order.end());
+                int priority = 0;
+                for (std::size_t r = 0; r < order.size(); r++) {
+                        if (r == 0 or std::get<0>(order[r]) != std::get<0>(order[r - 1]) or std::get<1>(order[r]) != std::get<1>(order[r - 1])) {
+                                priority++;
+                        }
+                        model.set_branch_priority(std::get<2>(order[r]), priority);
+                }
+        }
 
-                        model->set(GRB_DoubleParam_TimeLimit, opt_.timelimit_);
+        /**
+         * resets the per-pair statistics and computes the edit costs of (G, H) into arena_. Returns true if the pair is
+         * decided without a model, by the heuristic start mapping or by the Lagrangian bound, which lagrangian then holds.
+         */
+        bool prepare(graph<T, U> &G, graph<T, U> &H, std::optional<LAGRANGIAN_BOUND<T, U>> &lagrangian) {
+                auto n_g = G.number_of_nodes();
+                auto n_h = H.number_of_nodes();
+                auto m_g = G.number_of_edges();
+                auto m_h = H.number_of_edges();
 
+                opt_.vars_fixed_ = 0;
+                opt_.n_vars_full_ = 0;
+                opt_.n_cons_full_ = 0;
+                opt_.lpreltime = 0.0;
+                opt_.lagrangian_bound_ = 0.0;
+                opt_.lprelval = 0.0;
+                opt_.bbnodecount_ = 0.0;
+                opt_.lagrangian_time_ = 0.0;
+                opt_.race_winner_ = -1;
+                proven_greater_ = false;
+                if (opt_.formulation_name_ != "FORI" and opt_.formulation_name_ != "FORI-COMPACT") {
+                        throw std::runtime_error("FORI_VERIFICATION: unknown formulation " + opt_.formulation_name_ + ", use FORI or FORI-COMPACT");
+                }
+                const bool compact = opt_.formulation_name_ == "FORI-COMPACT";
 
-                        model->set(GRB_IntParam_Seed, opt_.seed_);
+                constant_ = 0.0;
+                start_objval_ = -1.0;
+                arena_.reshape(n_g, n_h, m_g, m_h, compact);
+                auto &c_ik = arena_.c_ik.rows;
+                auto &c_ie = arena_.c_ie;
+                auto &c_ek = arena_.c_ek;
+                auto &c_ijkl = arena_.c_ijkl.rows;
+                auto &c_ije = arena_.c_ije;
+                auto &c_ekl = arena_.c_ekl;
 
-                        model->set(GRB_IntAttr_ModelSense, GRB_MINIMIZE);
+                G.cost_function(G, H, c_ik, c_ie, c_ek, c_ijkl, c_ije, c_ekl);
 
-                        std::vector<std::vector<double>> c_ik(n_g, std::vector<double>(n_h, 0));
-                        std::vector<double> c_ie(n_g, 0);
-                        std::vector<double> c_ek(n_h, 0);
-                        std::vector<std::vector<double>> c_ijkl(m_g, std::vector<double>(m_h, 0));
-                        std::vector<double> c_ije(m_g, 0);
-                        std::vector<double> c_ekl(m_h, 0);
-                        GRBLinExpr objfunc;
+                if (G.get_dataset() == "CMU") {
+                        for (int i = 0; i < n_g; i++) {
+                                c_ie[i] = 0;
+                        }
+                        for (int k = 0; k < n_h; k++) {
+                                c_ek[k] = 0;
+                        }
+                }
 
-                        G.cost_function(G, H, c_ik, c_ie, c_ek, c_ijkl, c_ije, c_ekl);
+                if (!start_map_.empty()) {
+                        start_objval_ = mapping_cost(G, H, c_ik, c_ie, c_ek, c_ijkl, c_ije, c_ekl);
+                        // a top-k search ranks by the distance itself, there the mapping only warm starts the ILP
+                        if (start_objval_ < lowest_threshold() + 1e-9 and opt_.top_k_ == 0) {
+                                // the heuristic mapping already certifies GED <= threshold (every threshold of a sweep), no ILP needed
+                                opt_.objval_ = start_objval_;
+                                opt_.final_dualbound_ = 0;
+                                opt_.accepted_by_heuristic_++;
+                                return true;
+                        }
+                }
 
-                        if (G.get_dataset() == "CMU") {
-                                for (int i = 0; i < n_g; i++) {
-                                        c_ie[i] = 0;
-                                }
-                                for (int k = 0; k < n_h; k++) {
-                                        c_ek[k] = 0;
-                                }
+                // reduced cost fixing needs the bound as well, with lagrangian_ off it only fixes and never rejects
+                if (opt_.lagrangian_ or opt_.reduced_cost_fixing_) {
+                        auto lagrangian_start = std::chrono::high_resolution_clock::now();
+                        lagrangian.emplace(G, H, c_ik, c_ie, c_ek, c_ijkl, c_ije, c_ekl);
+                        opt_.lagrangian_bound_ = lagrangian->bound(opt_.threshold, opt_.lagrangian_iterations_);
+                        opt_.lagrangian_time_ = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - lagrangian_start).count();
+                        if (opt_.lagrangian_ and opt_.lagrangian_bound_ > opt_.threshold + 1e-6) {
+                                opt_.objval_ = opt_.lagrangian_bound_;
+                                opt_.final_dualbound_ = opt_.lagrangian_bound_;
+                                opt_.rejected_by_lagrangian_++;
+                                proven_greater_ = true;
+                                return true;
                         }
+                }
+                return false;
+        }
 
-                        for (int i = 0; i < n_g; i++) {
-                                for (int k = 0; k < n_h; k++) {
-                                        node_sub[i][k] = model->addVar(0, 1, 0, GRB_BINARY,
-                                                                       "x" + std::to_string(i) + "_" + std::to_string(k));
-                                        objfunc += (c_ik[i][k] - c_ie[i] - c_ek[k]) * node_sub[i][k];
+        /// sweep mode: several thresholds are decided by one exact solve capped at the largest one, opt_.threshold. A top-k
+        /// search solves exactly as well, capped at the distance of its current k-th nearest graph
+        [[nodiscard]] bool sweep() const { return opt_.thresholds.size() > 1 or opt_.top_k_ > 0; }
+
+        [[nodiscard]] double lowest_threshold() const {
+                return opt_.thresholds.empty() ? opt_.threshold : std::min(opt_.threshold, opt_.thresholds.front());
+        }
+
+        void configure(solver::MIPSolver &model, const std::string &log_suffix) {
+                model.set_model_name("FORI_VERIFICATION_"+opt_.dataset_name_ + "_"+opt_.G_id_ + "_" +opt_.H_id_);
+                model.set_log_file(opt_.log_fname_ + log_suffix + ".log");
+                model.set_threads(opt_.threads_);
+                model.set_time_limit(opt_.timelimit_);
+                model.set_seed(opt_.seed_);
+        }
+
+        /**
+         * adds the variables and constraints of the current pair to model, from the edit costs in arena_. The pair's
+         * objective ends up in arena_.objfunc and constant_; it is also the model objective if objective is set, a block
+         * of a batch model leaves the objective to its slot variable.
+         */
+        void add_pair(graph<T, U> &G, graph<T, U> &H, bool compact, const std::optional<LAGRANGIAN_BOUND<T, U>> &lagrangian,
+                      solver::MIPSolver &model, bool objective) {
+                int n_g = G.number_of_nodes();
+                int n_h = H.number_of_nodes();
+                int m_g = G.number_of_edges();
+                int m_h = H.number_of_edges();
+                auto &c_ik = arena_.c_ik.rows;
+                auto &c_ie = arena_.c_ie;
+                auto &c_ek = arena_.c_ek;
+                auto &c_ijkl = arena_.c_ijkl.rows;
+                auto &c_ije = arena_.c_ije;
+                auto &c_ekl = arena_.c_ekl;
+                auto &objfunc = arena_.objfunc;
+                objfunc.clear();
+                constant_ = 0.0;
+
+                auto &node_sub = arena_.node_sub.rows;
+                auto &edge_sub = arena_.edge_sub.rows;
+                auto &edge_sub_rev = arena_.edge_sub_rev.rows;
+
+                const double weight = objective ? 1.0 : 0.0;
+                model.update();
+                const int vars_before = model.num_vars();
+                const int constrs_before = model.num_constrs();
+
+                if (opt_.sparse_variables_) {
+                        node_lower_bounds(arena_, n_g, n_h, c_ik, c_ie, c_ek);
+                }
+                for (int i = 0; i < n_g; i++) {
+                        for (int k = 0; k < n_h; k++) {
+                                if (opt_.sparse_variables_ and not (arena_.node_lb.rows[i][k] <= opt_.threshold + 1e-9)) {
+                                        // also catches infinite substitution costs
+                                        node_sub[i][k] = -1;
+                                        continue;
                                 }
+                                node_sub[i][k] = model.add_var(0, 1, weight * (c_ik[i][k] - c_ie[i] - c_ek[k]), true,
+                                                               "x" + std::to_string(i) + "_" + std::to_string(k));
+                                objfunc.add(node_sub[i][k], c_ik[i][k] - c_ie[i] - c_ek[k]);
                         }
+                }
 
 
-                        for (int ij = 0; ij < m_g; ij++) {
-                                for (int kl = 0; kl < m_h; kl++) {
-                                        edge_sub[ij][kl] = model->addVar(0, 1, 0,
-                                                                         GRB_BINARY, "z_" + std::to_string(G.get_edge(ij).first) + "_" +
+                for (int ij = 0; ij < m_g; ij++) {
+                        auto [i, j] = G.get_edge(ij);
+                        for (int kl = 0; kl < m_h; kl++) {
+                                auto [k, l] = H.get_edge(kl);
+                                // an edge variable is only generated if the node variables it needs are
+                                bool straight = node_sub[i][k] >= 0 and node_sub[j][l] >= 0;
+                                bool crossed = node_sub[i][l] >= 0 and node_sub[j][k] >= 0;
+                                edge_sub[ij][kl] = -1;
+                                if (not compact) {
+                                        edge_sub_rev[ij][kl] = -1;
+                                }
+                                if (straight or (compact and crossed)) {
+                                        edge_sub[ij][kl] = model.add_var(0, 1, weight * (c_ijkl[ij][kl] - c_ije[ij] - c_ekl[kl]),
+                                                                         true, "z_" + std::to_string(G.get_edge(ij).first) + "_" +
                                                                                          std::to_string(G.get_edge(ij).second) + "_" + std::to_string(H.get_edge(kl).first) + "_" +
                                                                                          std::to_string(H.get_edge(kl).second));
-                                        objfunc += (c_ijkl[ij][kl] - c_ije[ij] - c_ekl[kl]) * edge_sub[ij][kl];
-                                        edge_sub_rev[ij][kl] = model->addVar(0, 1, 0,
-                                                                 GRB_BINARY, "z_" +  std::to_string(G.get_edge(ij).first) + "_" +
-                                                                                 std::to_string(G.get_edge(ij).second) + "_" + std::to_string(H.get_edge(kl).second) + "_" +
-                                                                                 std::to_string(H.get_edge(kl).first));
-                                        objfunc += (c_ijkl[ij][kl] - c_ije[ij] - c_ekl[kl]) * edge_sub_rev[ij][kl];
+                                        objfunc.add(edge_sub[ij][kl], c_ijkl[ij][kl] - c_ije[ij] - c_ekl[kl]);
                                 }
+                                if (compact or not crossed) {
+                                        continue;
+                                }
+                                edge_sub_rev[ij][kl] = model.add_var(0, 1, weight * (c_ijkl[ij][kl] - c_ije[ij] - c_ekl[kl]),
+                                                         true, "z_" +  std::to_string(G.get_edge(ij).first) + "_" +
+                                                                         std::to_string(G.get_edge(ij).second) + "_" + std::to_string(H.get_edge(kl).second) + "_" +
+                                                                         std::to_string(H.get_edge(kl).first));
+                                objfunc.add(edge_sub_rev[ij][kl], c_ijkl[ij][kl] - c_ije[ij] - c_ekl[kl]);
                         }
+                }
 
 
-                        GRBLinExpr le;
-                        for (int i = 0; i < n_g; i++) {
-                                le = 0;
-                                for (int k = 0; k < n_h; k++)
-                                        le += node_sub[i][k];
-                                model->addConstr(le, GRB_LESS_EQUAL, 1, "Ass_G_"+std::to_string(i));
+                auto &le = arena_.row;
+                for (int i = 0; i < n_g; i++) {
+                        le.clear();
+                        for (int k = 0; k < n_h; k++)
+                                le.add(node_sub[i][k]);
+                        if (le.size() > 0) {
+                                model.add_constr(le, solver::Sense::LESS_EQUAL, 1, "Ass_G_"+std::to_string(i));
                         }
+                }
 
-                        GRBLinExpr le1;
-                        for (int k = 0; k < n_h; k++) {
-                                le1 = 0;
-                                for (int i = 0; i < n_g; i++)
-                                        le1 += node_sub[i][k];
-                                model->addConstr(le1, GRB_LESS_EQUAL, 1, "Ass_H_"+std::to_string(k));
+                for (int k = 0; k < n_h; k++) {
+                        le.clear();
+                        for (int i = 0; i < n_g; i++)
+                                le.add(node_sub[i][k]);
+                        if (le.size() > 0) {
+                                model.add_constr(le, solver::Sense::LESS_EQUAL, 1, "Ass_H_"+std::to_string(k));
                         }
+                }
 
-                        GRBLinExpr le2;
-                        GRBLinExpr le3;
-                        for (int ij = 0; ij < m_g; ij++) {
-                                for (int k = 0; k < n_h; k++) {
-                                        le2 = 0;
-                                        le3 = node_sub[G.get_edge(ij).first][k];
-                                        for (int kl = 0; kl < m_h; kl++) {
-                                                if (k == H.get_edge(kl).first) {
-                                                        le2 += edge_sub[ij][kl];
-                                                }
-                                                else if(k == H.get_edge(kl).second) {
-                                                          le2 += edge_sub_rev[ij][kl];
-                                                }
-                                        }
-                                        model->addConstr(le2, GRB_LESS_EQUAL, le3, "Topological_1_G(" + std::to_string(G.get_edge(ij).first) + "," +
-                                                                                   std::to_string(G.get_edge(ij).second) + ")" + "_" + std::to_string(k));
-                                }
-                        }
+                if (compact) {
+                        add_compact_topological_constraints(G, H, model, node_sub, edge_sub);
+                } else {
+                        add_topological_constraints(G, H, model, node_sub, edge_sub, edge_sub_rev);
+                }
 
-                        le2.clear();
-                        le3.clear();
-                        for (int ij = 0; ij < m_g; ij++) {
-                                for (int k = 0; k < n_h; k++) {
-                                        le2.clear();
-                                        le3.clear();
-                                        le3 = node_sub[G.get_edge(ij).second][k];
-                                        for (int kl = 0; kl < m_h; kl++) {
-                                                if (k == H.get_edge(kl).first) {
-                                                        le2 += edge_sub_rev[ij][kl];
-                                                }
-                                                else if(k == H.get_edge(kl).second) {
-                                                        le2 += edge_sub[ij][kl];
-                                                }
-                                        }
-                                        model->addConstr(le2, GRB_LESS_EQUAL, le3, "Topological_2_G_(" + std::to_string(G.get_edge(ij).first) + "," +
-                                                                                   std::to_string(G.get_edge(ij).second) + ")" + "_" + std::to_string(k));
-                                }
-                        }
+                for (int i = 0; i < n_g; i++)
+                        constant_ += c_ie[i];
 
-                        le2.clear();
-                        le3.clear();
+                for (int k = 0; k < n_h; k++)
+                        constant_ += c_ek[k];
 
-                        for (int kl = 0; kl < m_h; kl++) {
-                          for (int i = 0; i < n_g; i++) {
-                                  le2.clear();
-                                  le3.clear();
-                            le3 = node_sub[i][H.get_edge(kl).first];
-                            for (int ij = 0; ij < m_g; ij++) {
-                              if (i == G.get_edge(ij).first) {
-                                le2 += edge_sub[ij][kl];
-                              }
-                              if (i == G.get_edge(ij).second) {
-                                le2 += edge_sub_rev[ij][kl];
-                              }
-                            }
-                                  model->addConstr(le2, GRB_LESS_EQUAL, le3, "Topological_H_(" + std::to_string(H.get_edge(kl).first) + "," +
-                                            std::to_string(H.get_edge(kl).second) + ")" + "_" +
-                                            std::to_string(i));
-                          }
-                        }
+                for (int ij = 0; ij < m_g; ij++)
+                        constant_ += c_ije[ij];
 
-                        le2.clear();
-                        le3.clear();
+                for (int kl = 0; kl < m_h; kl++)
+                        constant_ += c_ekl[kl];
 
-                        for (int kl = 0; kl < m_h; kl++) {
-                                for (int i = 0; i < n_g; i++) {
-                                        le2.clear();
-                                        le3.clear();
-                                        le3 = node_sub[i][H.get_edge(kl).second];
-                                        for (int ij = 0; ij < m_g; ij++) {
-                                                if (i == G.get_edge(ij).first) {
-                                                        le2 += edge_sub_rev[ij][kl];
-                                                }
-                                                if (i == G.get_edge(ij).second) {
-                                                        le2 += edge_sub[ij][kl];
-                                                }
-                                        }
-                                        model->addConstr(le2, GRB_LESS_EQUAL, le3, "Topological_H_(" + std::to_string(H.get_edge(kl).second) + "," +
-                                                  std::to_string(H.get_edge(kl).first) + ")" + "_" +
-                                                  std::to_string(i));
-                                }
-                        }
+                if (objective) {
+                        model.set_obj_constant(constant_);
+                }
+                model.update();
+                opt_.n_vars_full_ = model.num_vars() - vars_before;
+                opt_.n_cons_full_ = model.num_constrs() - constrs_before;
 
-                        for (int i = 0; i < n_g; i++)
-                                constant_ += c_ie[i];
+                if (!start_map_.empty()) {
+                        set_mip_start(G, H, model, node_sub, edge_sub, edge_sub_rev, c_ijkl, c_ije, c_ekl);
+                }
+                model.set_output(true);
 
-                        for (int k = 0; k < n_h; k++)
-                                constant_ += c_ek[k];
+                if (lagrangian and opt_.reduced_cost_fixing_) {
+                        opt_.vars_fixed_ = fix_by_reduced_cost(G, H, model, node_sub, edge_sub, edge_sub_rev, opt_.lagrangian_bound_,
+                                                               [&lagrangian](int i, int k) { return lagrangian->node_reduced_cost(i, k); });
+                }
+                set_branching(G, H, model, node_sub, c_ik, c_ie, c_ek, opt_.lagrangian_bound_,
+                              [&lagrangian](int i, int k) { return lagrangian ? lagrangian->node_reduced_cost(i, k) : 0.0; });
+        }
 
-                        for (int ij = 0; ij < m_g; ij++)
-                                constant_ += c_ije[ij];
+        /**
+         * builds the verification model of the current pair in env, including the threshold row and the solver settings.
+         * log_suffix keeps the log files of racing copies apart.
+         */
+        std::unique_ptr<solver::MIPSolver> build_model(graph<T, U> &G, graph<T, U> &H, bool compact,
+                                                       const std::optional<LAGRANGIAN_BOUND<T, U>> &lagrangian, const std::string &log_suffix,
+                                                       solver::environment &env) {
+                auto model = solver::make_solver(opt_.solver_backend_, env);
+                configure(*model, log_suffix);
+                add_pair(G, H, compact, lagrangian, *model, true);
+                auto &objfunc = arena_.objfunc;
+
+                // objfunc + constant_ <= threshold
+                model->add_constr(objfunc, solver::Sense::LESS_EQUAL, opt_.threshold - constant_, "threshold");
+
+                // one solve: the root relaxation is the LP stage, if its bound exceeds the threshold the solver stops at the
+                // root (cutoff or infeasible threshold row) instead of solving the same LP again in a separate MIP
+                model->set_cutoff(opt_.threshold + 1e-6);
+                model->set_barrier(true);
+                if (auto tuned = profile_.find(model_size(G, H))) {
+                        tuned->apply(*model, opt_.threads_);
+                }
+                if (sweep()) {
+                        // the exact GED below the cap decides every threshold at once, the first solution only decides the cap
+                        model->set_mip_gap(0.0);
+                } else {
+                        model->set_solution_limit(1);
+                }
+                return model;
+        }
 
-                        for (int kl = 0; kl < m_h; kl++)
-                                constant_ += c_ekl[kl];
+        /// INFEASIBLE and CUTOFF prove GED > threshold, a feasible solution proves GED <= threshold (threshold row), a sweep
+        /// needs the optimum
+        [[nodiscard]] inline bool conclusive(solver::Status status) const {
+                return status == solver::Status::INFEASIBLE or status == solver::Status::CUTOFF or status == solver::Status::OPTIMAL or
+                       (status == solver::Status::SOLUTION_LIMIT and not sweep());
+        }
 
-                        auto cons = model->addVar(1.0,1.0,0,GRB_BINARY,"constant");
-                        objfunc += cons*constant_;
-                        model->update();
-                        model->setObjective(objfunc);
-                        model->set(GRB_IntParam_OutputFlag, 1);
+        /**
+         * decision mode (--race): model is tuned to find a solution <= threshold, a second copy built in its own solver
+         * environment is tuned to prove that none exists. Both run at the same time with half of the threads each, the first
+         * conclusive answer terminates the other copy and model ends up owning the copy that decided.
+         */
+        solver::Status race(graph<T, U> &G, graph<T, U> &H, bool compact, const std::optional<LAGRANGIAN_BOUND<T, U>> &lagrangian,
+                            std::unique_ptr<solver::MIPSolver> &model) {
+                auto bound_model = build_model(G, H, compact, lagrangian, "_bound", race_env_);
+                std::array<solver::MIPSolver *, 2> racers{model.get(), bound_model.get()};
+                racers[0]->set_focus(solver::Focus::FEASIBILITY);
+                racers[1]->set_focus(solver::Focus::BOUND);
+                for (auto racer: racers) {
+                        racer->set_threads(std::max(1, opt_.threads_ / 2));
+                }
 
-                        for (int i = 0; i < model->get(GRB_IntAttr_NumVars); ++i) {
-                                GRBVar var = model->getVar(i);
-                                var.set(GRB_CharAttr_VType, GRB_CONTINUOUS);
-                        }
-                        model->update();
-                        model->set(GRB_IntParam_Method, 2);
-                        
-                        model->set(GRB_IntParam_Crossover, 0);
-                        model->optimize();
-                        if(model->get(GRB_DoubleAttr_ObjVal) < opt_.threshold + 1e-6){
-                                model->reset();
-                                model->addConstr(objfunc <= opt_.threshold, "threshold");
-                                for (int i = 0; i < model->get(GRB_IntAttr_NumVars); ++i) {
-                                        GRBVar var = model->getVar(i);
-                                        var.set(GRB_CharAttr_VType, GRB_BINARY);
-                                }
-                                model->update();
-                                model->set(GRB_IntParam_Method, 2);
-                        
-                                model->set(GRB_IntParam_Crossover, 0);
-                                model->set(GRB_IntParam_SolutionLimit, 1);
-                        model->addConstr(objfunc <= opt_.threshold, "threshold");
-                        model->set(GRB_IntParam_SolutionLimit, 1);
-                        model->optimize();
-                        }
-                        else {
-                                opt_.objval_ = model->get(GRB_DoubleAttr_ObjVal);
-                                opt_.final_dualbound_ = model->get(GRB_DoubleAttr_ObjVal);
-                                delete[] node_sub;
-                                delete[] edge_sub;
-                                delete[] edge_sub_rev;
-                                delete model;
-                                delete env;
-
-                                return "OK";
+                std::array<solver::Status, 2> status{solver::Status::OTHER, solver::Status::OTHER};
+                std::atomic<int> winner{-1};
+                auto run = [&](int r) {
+                        status[r] = racers[r]->optimize();
+                        // only the copy that claims the win terminates the other one, a request that reaches the other copy
+                        // before its optimize() started stops it right away
+                        int undecided = -1;
+                        if (conclusive(status[r]) and winner.compare_exchange_strong(undecided, r)) {
+                                racers[1 - r]->terminate();
                         }
-                                
-                        
-                        model->optimize();
-
-                      
-                        opt_.constant_ = constant_;
-
-                        if(opt_.flat) {
-                                int status = model->get(GRB_IntAttr_Status);
-
-                                if (status == GRB_INF_OR_UNBD || status == GRB_INFEASIBLE) {
-                                        opt_.objval_ = std::numeric_limits<double>::max();
-                                        opt_.final_dualbound_ = 0;
-                                        delete[] node_sub;
-                                        delete[] edge_sub;
-                                        delete[] edge_sub_rev;
-                                        delete model;
-                                        delete env;
-
-                                        return "OK";
-                                }
+                };
+                std::thread bound_thread(run, 1);
+                run(0);
+                bound_thread.join();
+
+                opt_.race_winner_ = winner.load();
+                if (opt_.race_winner_ == 1) {
+                        std::swap(model, bound_model);
+                        return status[1];
+                }
+                return status[0];
+        }
+
+public:
+
+        FORI_VERIFICATION() = default;
+
+        explicit FORI_VERIFICATION(options &opt) : opt_(opt) {}
+
+
+        inline void relax() {
+                relax_ = true;
+                opt_.relaxed_ = true;
+        }
+
+        inline void set_testing() { testing_ = true; }
+
+        inline void set_threads(int threads) { threads_ = threads; }
+
+        inline void set_seed(int seed) { seed_ = seed; }
+
+        /**
+         * provide a heuristic node mapping (e.g. from GEDLIB's BRANCH or any LSAP upper bound) as MIP start
+         * @param node_map node_map[i] is the node of H that node i of G is substituted with, or -1 if i is deleted
+         */
+        inline void set_start_mapping(std::vector<int> node_map) { start_map_ = std::move(node_map); }
+
+        /// use the solver parameters of a tune_verification profile for every model built from now on
+        inline void set_profile(solver_profile profile) { profile_ = std::move(profile); }
+
+        /// number of variables of the verification model of (G, H) before sparse generation and reduced cost fixing, the size bucket of a solver_profile
+        [[nodiscard]] int model_size(graph<T, U> &G, graph<T, U> &H) const {
+                int m = G.number_of_edges() * H.number_of_edges();
+                return G.number_of_nodes() * H.number_of_nodes() + (opt_.formulation_name_ == "FORI-COMPACT" ? m : 2 * m);
+        }
+
+        /// objective value of the start mapping under the cost model of the verification ILP, -1 if none was given
+        [[nodiscard]] double start_objval() const { return start_objval_; }
+
+        std::string log_name_;
+        std::string output_fname_;
+        double timelimit_ = 0;
+        options &opt_;
+
+
+
+        /**
+         * verifies GED(G, H) <= opt_.threshold and writes the result into opt_. In sweep mode (opt_.thresholds) the model is
+         * solved to optimality instead, objval_ is then the exact GED if it is at most opt_.threshold. The object can be reused for any number
+         * of pairs, its buffers are kept in arena_ and the solver model is released on every return.
+         * @throws std::runtime_error on solver errors, the caller decides whether to skip the pair or stop
+         */
+        std::string ged(graph<T, U> &G, graph<T, U> &H) {
+                std::optional<LAGRANGIAN_BOUND<T, U>> lagrangian;
+                if (prepare(G, H, lagrangian)) {
+                        return "OK";
+                }
+                const bool compact = opt_.formulation_name_ == "FORI-COMPACT";
+
+                auto model = build_model(G, H, compact, lagrangian, "", env_);
+                auto status = opt_.race_ ? race(G, H, compact, lagrangian, model) : model->optimize();
+                opt_.lprelval = model->root_bound();
+                opt_.lpreltime = model->root_time();
+                opt_.bbnodecount_ = model->node_count();
+
+                opt_.constant_ = constant_;
+
+                if (status == solver::Status::INFEASIBLE or status == solver::Status::CUTOFF) {
+                        proven_greater_ = true;
+                        opt_.objval_ = std::numeric_limits<double>::max();
+                        // the cutoff can end the solve before the solver reports a root bound, the root then proved at least
+                        // the threshold
+                        if (opt_.lprelval == -std::numeric_limits<double>::infinity()) {
+                                opt_.lprelval = opt_.threshold;
+                                opt_.lpreltime = model->runtime();
                         }
-                        opt_.bbnodecount_ = model->get(GRB_DoubleAttr_NodeCount);
-                        opt_.mipgap_ = model->get(GRB_DoubleAttr_MIPGap);
-                        opt_.objval_ = model->get(GRB_DoubleAttr_ObjVal);
-                        opt_.final_dualbound_ = model->get(GRB_DoubleAttr_ObjBound);
-                        opt_.time_ = model->get(GRB_DoubleAttr_Runtime);
-                        opt_.status_ = model->get(GRB_IntAttr_Status);
-                        opt_.n_vars_full_ = model->get(GRB_IntAttr_NumVars);
-                        opt_.n_cons_full_ = model->get(GRB_IntAttr_NumConstrs);
-                        opt_.numNZ_ = model->get(GRB_IntAttr_NumNZs);
-                        opt_.iterCount_ = model->get(GRB_DoubleAttr_IterCount);
-
-                        delete[] node_sub;
-                        delete[] edge_sub;
-                        delete[] edge_sub_rev;
-                        delete model;
-                        delete env;
+                        opt_.final_dualbound_ = std::max(opt_.lprelval, opt_.threshold);
+                        opt_.time_ = model->runtime();
+                        opt_.status_ = static_cast<int>(status);
 
                         return "OK";
                 }
-                catch (GRBException &e) {
-                        std::cout << "Error code = " << e.getErrorCode() << std::endl;
-                        std::cout << e.getMessage() << std::endl;
+                opt_.bbnodecount_ = model->node_count();
+                opt_.mipgap_ = model->mip_gap();
+                opt_.objval_ = model->obj_val();
+                opt_.final_dualbound_ = model->obj_bound();
+                opt_.time_ = model->runtime();
+                opt_.status_ = static_cast<int>(status);
+                opt_.n_vars_full_ = model->num_vars();
+                opt_.n_cons_full_ = model->num_constrs();
+                opt_.numNZ_ = model->num_nz();
+                opt_.iterCount_ = model->iter_count();
+
+                return "OK";
+        }
+
+        /// @brief bounds on GED(G, H) proven by the last ged(), a rejection is recorded as the next double above the threshold
+        [[nodiscard]] bound_cache::entry proven_bounds() const {
+                bound_cache::entry e;
+                e.lower = std::max(0.0, opt_.final_dualbound_);
+                if (proven_greater_) {
+                        e.lower = std::max(e.lower, std::nextafter(opt_.threshold, std::numeric_limits<double>::max()));
+                }
+                if (opt_.objval_ < opt_.threshold + 1e-9) {
+                        e.upper = opt_.objval_;
+                }
+                return e;
+        }
+
+        /// decision for one pair of a batch
+        struct batch_result {
+                std::string tag;
+                /// false if the solve stopped before it decided the block, the pair then has to be verified alone
+                bool decided = false;
+                bool accepted = false;
+                double objval = std::numeric_limits<double>::max();
+                double dualbound = 0.0;
+        };
+
+        /// @brief only pairs with at most a quarter of opt_.batch_vars_ variables are batched, larger ones are solved alone with
+        /// ged(). A batch only decides opt_.threshold, so sweeps are never batched.
+        [[nodiscard]] bool batchable(graph<T, U> &G, graph<T, U> &H) const {
+                return opt_.batch_size_ > 1 and not sweep() and 4 * model_size(G, H) <= opt_.batch_vars_;
+        }
+
+        /// @brief false if (G, H) would push the pending batch over opt_.batch_size_ pairs or opt_.batch_vars_ variables
+        [[nodiscard]] bool batch_has_room(graph<T, U> &G, graph<T, U> &H) const {
+                return static_cast<int>(batch_.size()) < opt_.batch_size_ and batch_vars_ + model_size(G, H) <= opt_.batch_vars_;
+        }
+
+        /**
+         * queues (G, H) as one block of a block-diagonal batch model that batch_solve() decides with a single optimize().
+         * A block is the model of ged() whose threshold row is switched by a slot variable s:
+         *      objfunc + M s <= threshold - constant + M,  M = max(0, constant - threshold)
+         * With s = 0 the row holds for x = 0, so every block stays feasible on its own, and minimizing -sum s sets s = 1
+         * exactly for the pairs with GED <= threshold.
+         * @return false if the pair was decided without a model (opt_ holds the result as after ged()), true if it was queued
+         */
+        bool batch_add(graph<T, U> &G, graph<T, U> &H, const std::string &tag) {
+                std::optional<LAGRANGIAN_BOUND<T, U>> lagrangian;
+                if (prepare(G, H, lagrangian)) {
+                        return false;
+                }
+                const bool compact = opt_.formulation_name_ == "FORI-COMPACT";
+                if (!batch_model_) {
+                        batch_model_ = solver::make_solver(opt_.solver_backend_, env_);
+                        configure(*batch_model_, "_batch");
+                        if (auto tuned = profile_.find(opt_.batch_vars_)) {
+                                tuned->apply(*batch_model_, opt_.threads_);
+                        }
+                }
+                add_pair(G, H, compact, lagrangian, *batch_model_, false);
+
+                double big_m = std::max(0.0, constant_ - opt_.threshold);
+                int slot = batch_model_->add_var(0, 1, -1.0, true, "s" + std::to_string(batch_.size()));
+                auto &row = arena_.row;
+                row = arena_.objfunc;
+                row.add(slot, big_m);
+                batch_model_->add_constr(row, solver::Sense::LESS_EQUAL, opt_.threshold - constant_ + big_m, "threshold_" + std::to_string(batch_.size()));
+                batch_.push_back({tag, slot, arena_.objfunc, constant_});
+                batch_vars_ += model_size(G, H);
+
+                opt_.objval_ = std::numeric_limits<double>::max();
+                opt_.final_dualbound_ = 0;
+                return true;
+        }
+
+        /**
+         * solves the pending batch and returns one decision per queued pair, in the order of batch_add(). If the solve
+         * stops early (time limit), only the blocks whose slot is 1 in the incumbent are decided, the others are reported
+         * as undecided and not as rejected: s = 0 in an incumbent says nothing about the GED of the pair.
+         */
+        std::vector<batch_result> batch_solve() {
+                std::vector<batch_result> results;
+                if (batch_.empty()) {
+                        return results;
                 }
-                exit(1);
+                auto &model = *batch_model_;
+                model.update();
+                auto status = model.optimize();
+                bool has_solution = model.obj_val() < std::numeric_limits<double>::max();
+                for (auto &block: batch_) {
+                        batch_result result;
+                        result.tag = block.tag;
+                        if (has_solution and model.value(block.slot) > 0.5) {
+                                result.decided = true;
+                                result.accepted = true;
+                                result.objval = block.constant;
+                                for (std::size_t t = 0; t < block.objfunc.size(); t++) {
+                                        result.objval += block.objfunc.coefs[t] * model.value(block.objfunc.vars[t]);
+                                }
+                        } else if (status == solver::Status::OPTIMAL) {
+                                // the optimum sets every slot it can, so this block has GED > threshold
+                                result.decided = true;
+                                result.dualbound = opt_.threshold;
+                        }
+                        results.push_back(std::move(result));
+                }
+                opt_.time_ = model.runtime();
+                opt_.status_ = static_cast<int>(status);
+                opt_.batch_sizes.push_back(static_cast<int>(batch_.size()));
+
+                batch_model_.reset();
+                batch_.clear();
+                batch_vars_ = 0;
+                return results;
+        }
+
+        /// @brief drops the pending batch without solving it, e.g. when the search it belongs to was cancelled
+        void batch_discard() {
+                batch_model_.reset();
+                batch_.clear();
+                batch_vars_ = 0;
         }
 
 };
@@ -0,0 +1,184 @@
+#ifndef GEDC_VERIFICATION_POOL_HPP
+#define GEDC_VERIFICATION_POOL_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "auxiliary/bound_cache.hpp"
+#include "auxiliary/graph.hpp"
+#include "auxiliary/options.hpp"
+#include "auxiliary/pair_difficulty.hpp"
+#include "auxiliary/solver_profile.hpp"
+#include "auxiliary/worker_pool.hpp"
+#include "gurobi/FORI_VERIFICATION.hpp"
+
+/**
+ * verifies queued pairs concurrently on opt.workers_ threads. Every worker owns a copy of the run's options and a
+ * FORI_VERIFICATION bound to it (solver environment, arena buffers), so ged() never touches the options of the caller;
+ * the per-pair fields it writes are handed back as results and folded in by the caller, in the order of add().
+ * Each model gets max(1, opt.threads_ / opt.workers_) solver threads: tiny molecule ILPs gain more from solving many
+ * pairs at once than from many threads per model. The pairs are scheduled by worker_pool on their estimated difficulty,
+ * so the few pairs that run for minutes start first and do not trail behind the thousands that take microseconds.
+ */
+template<typename T, typename U>
+class verification_pool {
+public:
+        /// what ged() and proven_bounds() report for one pair
+        struct result {
+                double objval = std::numeric_limits<double>::max();
+                double dualbound = 0.0;
+                int vars_fixed = 0;
+                int model_vars = 0;
+                int model_constrs = 0;
+                double lp_time = 0.0;
+                double lagrangian_bound = 0.0;
+                double lagrangian_time = 0.0;
+                double root_bound = 0.0;
+                double bb_nodes = 0.0;
+                int race_winner = -1;
+                bound_cache::entry proven;
+                /// wall time of ged() in nanoseconds
+                long time = 0;
+                /// solver::Status of the model, TIME_LIMIT if the pair used up its budget, 0 if it was decided without a model
+                int status = 0;
+                /// the start mapping accepted the pair, or the Lagrangian bound rejected it, before the model was built
+                bool accepted_by_heuristic = false;
+                bool rejected_by_lagrangian = false;
+        };
+
+        explicit verification_pool(const options &opt) : pool_(std::max(1, opt.workers_)), timelimit_(opt.timelimit_) {
+                for (int w = 0; w < pool_.size(); w++) {
+                        workers_.push_back(std::make_unique<worker>(opt));
+                        auto &copy = workers_.back()->opt;
+                        copy.threads_ = threads_per_model(opt);
+                        // the solvers write their logs concurrently, one file per worker
+                        copy.log_fname_ += "_worker" + std::to_string(w);
+                }
+        }
+
+        [[nodiscard]] static int threads_per_model(const options &opt) { return std::max(1, opt.threads_ / std::max(1, opt.workers_)); }
+
+        [[nodiscard]] int workers() const { return pool_.size(); }
+
+        /// use the solver parameters of a tune_verification profile in every worker
+        void set_profile(const solver_profile &profile) {
+                for (auto &w: workers_) {
+                        w->ilp.set_profile(profile);
+                }
+        }
+
+        [[nodiscard]] std::size_t pending() const { return jobs_.size(); }
+
+        /// @brief decide the next solve() at threshold (and the sweep thresholds), the workers copied them from the run's options
+        void set_thresholds(double threshold, const std::vector<double> &thresholds) {
+                for (auto &w: workers_) {
+                        w->opt.threshold = threshold;
+                        w->opt.thresholds = thresholds;
+                }
+        }
+
+        /// @brief drops the queued pairs without verifying them
+        void discard() { jobs_.clear(); }
+
+        /// pairs of the last solve() that ran on another worker than the one they were dealt to
+        [[nodiscard]] std::size_t steals() const { return pool_.steals(); }
+
+        /**
+         * estimated cost of the verification ILP of (G, H), only used to order the schedule: the number of variables
+         * times a factor that grows as the bounds known before the ILP close in on the threshold, see pair_difficulty().
+         * @param by_start_map ged() accepts the pair by its start mapping without a model: the pair has a start mapping
+         * whose cost meets the lowest threshold of the query, and the query is not a top-k search
+         */
+        [[nodiscard]] static double difficulty(const graph<T, U> &G, const graph<T, U> &H, double lower, double upper, double threshold,
+                                               bool by_start_map) {
+                if (by_start_map) {
+                        return 1.0;
+                }
+                const double vars = static_cast<double>(G.number_of_nodes()) * H.number_of_nodes() +
+                                    static_cast<double>(G.number_of_edges()) * H.number_of_edges();
+                return pair_difficulty(vars, lower, upper, threshold);
+        }
+
+        /**
+         * queues (G, H) for the next solve(). G is copied together with the edit costs of this pair, so the caller may
+         * overwrite them for the next candidate; H is referenced and must stay alive and unchanged until solve() returns.
+         * @param start_map GEDLIB node map as MIP start, empty for none
+         * @param difficulty estimated cost, see difficulty()
+         * @param budget time limit of this pair in seconds, at most the run's timelimit_ (0: the run's timelimit_)
+         */
+        void add(const graph<T, U> &G, graph<T, U> &H, std::vector<int> start_map, double difficulty = 1.0, double budget = 0.0) {
+                jobs_.push_back({G, &H, std::move(start_map), difficulty, budget});
+        }
+
+        /// @brief verifies every queued pair and returns their results in the order of add()
+        /// @throws the first std::runtime_error of a ged(), after the other workers stopped
+        std::vector<result> solve() {
+                std::vector<result> results(jobs_.size());
+                std::vector<double> cost(jobs_.size());
+                for (std::size_t j = 0; j < jobs_.size(); j++) {
+                        cost[j] = jobs_[j].difficulty;
+                }
+                pool_.run(jobs_.size(), [&](int w, std::size_t j) {
+                        auto &[opt, ilp] = *workers_[w];
+                        auto &job = jobs_[j];
+                        // configure() reads the time limit when the model is built
+                        opt.timelimit_ = job.budget > 0 ? std::min(job.budget, timelimit_) : timelimit_;
+                        const int heuristic = opt.accepted_by_heuristic_;
+                        const int lagrangian = opt.rejected_by_lagrangian_;
+                        auto start = std::chrono::high_resolution_clock::now();
+                        opt.status_ = 0;
+                        ilp.set_start_mapping(std::move(job.start_map));
+                        ilp.ged(job.G, *job.H);
+                        auto end = std::chrono::high_resolution_clock::now();
+
+                        auto &r = results[j];
+                        r.objval = opt.objval_;
+                        r.dualbound = opt.final_dualbound_;
+                        r.vars_fixed = opt.vars_fixed_;
+                        r.model_vars = opt.n_vars_full_;
+                        r.model_constrs = opt.n_cons_full_;
+                        r.lp_time = opt.lpreltime;
+                        r.lagrangian_bound = opt.lagrangian_bound_;
+                        r.lagrangian_time = opt.lagrangian_time_;
+                        r.root_bound = opt.lprelval;
+                        r.bb_nodes = opt.bbnodecount_;
+                        r.race_winner = opt.race_winner_;
+                        r.proven = ilp.proven_bounds();
+                        r.time = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+                        r.status = opt.status_;
+                        r.accepted_by_heuristic = opt.accepted_by_heuristic_ > heuristic;
+                        r.rejected_by_lagrangian = opt.rejected_by_lagrangian_ > lagrangian;
+                        opt.objval_ = std::numeric_limits<double>::max();
+                }, cost);
+                jobs_.clear();
+                return results;
+        }
+
+private:
+        struct worker {
+                options opt;
+                FORI_VERIFICATION<T, U> ilp;
+
+                explicit worker(const options &base) : opt(base), ilp(opt) {}
+        };
+
+        struct job {
+                graph<T, U> G;
+                graph<T, U> *H;
+                std::vector<int> start_map;
+                double difficulty;
+                double budget;
+        };
+
+        worker_pool pool_;
+        double timelimit_;
+        /// not movable, ilp refers to opt
+        std::vector<std::unique_ptr<worker>> workers_;
+        std::vector<job> jobs_;
+};
+
+#endif //GEDC_VERIFICATION_POOL_HPP
@@ -0,0 +1,310 @@
+#ifndef GEDC_GUROBI_SOLVER_HPP
+#define GEDC_GUROBI_SOLVER_HPP
+
+#ifdef FORI_WITH_GUROBI
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "gurobi_c++.h"
+#include "solver/MIPSolver.hpp"
+
+namespace solver {
+
+        /**
+         * records the bound of the root node. Until the root relaxation is solved, the bound of the progress callbacks at
+         * node 0 is recorded, so a solve that the cutoff ends at the root still reports the bound it reached.
+         */
+        class GurobiCallback : public GRBCallback {
+        public:
+                double root_bound = -std::numeric_limits<double>::infinity();
+                double root_time = 0.0;
+                bool root_done = false;
+                /// set by terminate(), kept by clear() so that a request made before optimize() started is not lost
+                std::atomic<bool> terminate_requested{false};
+
+                inline void clear() {
+                        root_bound = -std::numeric_limits<double>::infinity();
+                        root_time = 0.0;
+                        root_done = false;
+                }
+
+        protected:
+                void callback() override {
+                        if (terminate_requested.load()) {
+                                abort();
+                                return;
+                        }
+                        if (where == GRB_CB_MIP and not root_done and getDoubleInfo(GRB_CB_MIP_NODCNT) == 0) {
+                                double bound = getDoubleInfo(GRB_CB_MIP_OBJBND);
+                                if (bound > -GRB_INFINITY and bound > root_bound) {
+                                        root_bound = bound;
+                                        root_time = getDoubleInfo(GRB_CB_RUNTIME);
+                                }
+                                return;
+                        }
+                        if (root_done or where != GRB_CB_MIPNODE or getIntInfo(GRB_CB_MIPNODE_STATUS) != GRB_OPTIMAL) {
+                                return;
+                        }
+                        if (getDoubleInfo(GRB_CB_MIPNODE_NODCNT) == 0) {
+                                root_bound = getDoubleInfo(GRB_CB_MIPNODE_OBJBND);
+                                root_time = getDoubleInfo(GRB_CB_RUNTIME);
+                                root_done = true;
+                        }
+                }
+        };
+
+        /// MIPSolver backed by the gurobi C++ api, every GRBException is rethrown as std::runtime_error
+        class GurobiSolver : public MIPSolver {
+        private:
+                /// shared with the other models of the worker, see solver::environment
+                std::shared_ptr<GRBEnv> env_;
+                std::unique_ptr<GRBModel> model_;
+                std::vector<GRBVar> vars_;
+                std::vector<char> vtypes_;
+                GurobiCallback callback_;
+
+                template<typename F>
+                static inline auto guard(F &&f) -> decltype(f()) {
+                        try {
+                                return f();
+                        }
+                        catch (GRBException &e) {
+                                throw std::runtime_error("Gurobi error code = " + std::to_string(e.getErrorCode()) + ": " + e.getMessage());
+                        }
+                }
+
+        public:
+                /// @brief starts a gurobi environment, which checks the license; the models of one thread share it
+                static std::shared_ptr<GRBEnv> make_env() {
+                        return guard([] { return std::make_shared<GRBEnv>(); });
+                }
+
+                explicit GurobiSolver(std::shared_ptr<GRBEnv> env) : env_(std::move(env)) {
+                        guard([this] {
+                                model_ = std::make_unique<GRBModel>(*env_);
+                                model_->set(GRB_IntAttr_ModelSense, GRB_MINIMIZE);
+                                model_->setCallback(&callback_);
+                        });
+                }
+
+                [[nodiscard]] std::string name() const override { return "gurobi"; }
+
+                int add_var(double lb, double ub, double obj, bool integer, const std::string &name) override {
+                        char vtype = GRB_CONTINUOUS;
+                        if (integer) {
+                                vtype = (lb >= 0 and ub <= 1) ? GRB_BINARY : GRB_INTEGER;
+                        }
+                        guard([&] { vars_.push_back(model_->addVar(lb, ub, obj, vtype, name)); });
+                        vtypes_.push_back(vtype);
+                        return static_cast<int>(vars_.size()) - 1;
+                }
+
+                void add_constr(const LinExpr &lhs, Sense sense, double rhs, const std::string &name) override {
+                        guard([&] {
+                                GRBLinExpr le;
+                                for (std::size_t t = 0; t < lhs.size(); t++) {
+                                        le += lhs.coefs[t] * vars_[lhs.vars[t]];
+                                }
+                                char s = sense == Sense::LESS_EQUAL ? GRB_LESS_EQUAL : (sense == Sense::GREATER_EQUAL ? GRB_GREATER_EQUAL : GRB_EQUAL);
+                                model_->addConstr(le, s, rhs, name);
+                        });
+                }
+
+                void set_obj_constant(double constant) override {
+                        guard([&] { model_->set(GRB_DoubleAttr_ObjCon, constant); });
+                }
+
+                void set_integrality(bool integer) override {
+                        guard([&] {
+                                for (std::size_t v = 0; v < vars_.size(); v++) {
+                                        vars_[v].set(GRB_CharAttr_VType, integer ? vtypes_[v] : GRB_CONTINUOUS);
+                                }
+                                model_->update();
+                        });
+                }
+
+                void set_ub(int var, double ub) override {
+                        guard([&] { vars_[var].set(GRB_DoubleAttr_UB, ub); });
+                }
+
+                [[nodiscard]] double get_ub(int var) const override {
+                        return guard([&] { return vars_[var].get(GRB_DoubleAttr_UB); });
+                }
+
+                void set_start(int var, double value) override {
+                        guard([&] { vars_[var].set(GRB_DoubleAttr_Start, value); });
+                }
+
+                void set_branch_priority(int var, int priority) override {
+                        guard([&] { vars_[var].set(GRB_IntAttr_BranchPriority, priority); });
+                }
+
+                void set_branch_hint(int var, double value) override {
+                        guard([&] { vars_[var].set(GRB_DoubleAttr_VarHintVal, value); });
+                }
+
+                void update() override {
+                        guard([&] { model_->update(); });
+                }
+
+                void reset() override {
+                        callback_.terminate_requested = false;
+                        guard([&] { model_->reset(); });
+                }
+
+                void set_model_name(const std::string &name) override {
+                        guard([&] { model_->set(GRB_StringAttr_ModelName, name); });
+                }
+
+                void set_log_file(const std::string &path) override {
+                        guard([&] { model_->set(GRB_StringParam_LogFile, path); });
+                }
+
+                void set_output(bool output) override {
+                        guard([&] { model_->set(GRB_IntParam_OutputFlag, output ? 1 : 0); });
+                }
+
+                void set_threads(int threads) override {
+                        guard([&] { model_->set(GRB_IntParam_Threads, threads); });
+                }
+
+                void set_time_limit(double seconds) override {
+                        guard([&] { model_->set(GRB_DoubleParam_TimeLimit, seconds); });
+                }
+
+                void set_seed(int seed) override {
+                        guard([&] { model_->set(GRB_IntParam_Seed, seed); });
+                }
+
+                void set_solution_limit(int limit) override {
+                        guard([&] { model_->set(GRB_IntParam_SolutionLimit, limit); });
+                }
+
+                void set_mip_gap(double gap) override {
+                        guard([&] { model_->set(GRB_DoubleParam_MIPGap, gap); });
+                }
+
+                void set_focus(Focus focus) override {
+                        guard([&] { model_->set(GRB_IntParam_MIPFocus, focus == Focus::FEASIBILITY ? 1 : (focus == Focus::BOUND ? 3 : 0)); });
+                }
+
+                void set_branch_direction(int direction) override {
+                        guard([&] { model_->set(GRB_IntParam_BranchDir, direction); });
+                }
+
+                void set_barrier(bool crossover) override {
+                        guard([&] {
+                                model_->set(GRB_IntParam_Method, 2);
+                                model_->set(GRB_IntParam_Crossover, crossover ? -1 : 0);
+                        });
+                }
+
+                void set_lp_method(LpMethod method) override {
+                        int value = method == LpMethod::PRIMAL_SIMPLEX ? 0 : method == LpMethod::DUAL_SIMPLEX ? 1 : method == LpMethod::BARRIER ? 2 : -1;
+                        guard([&] {
+                                model_->set(GRB_IntParam_Method, value);
+                                model_->set(GRB_IntParam_Crossover, -1);
+                        });
+                }
+
+                void set_presolve(int level) override {
+                        guard([&] { model_->set(GRB_IntParam_Presolve, level); });
+                }
+
+                void set_cuts(int level) override {
+                        guard([&] { model_->set(GRB_IntParam_Cuts, level); });
+                }
+
+                void set_heuristics(double effort) override {
+                        guard([&] { model_->set(GRB_DoubleParam_Heuristics, effort); });
+                }
+
+                void set_cutoff(double cutoff) override {
+                        guard([&] { model_->set(GRB_DoubleParam_Cutoff, cutoff); });
+                }
+
+                Status optimize() override {
+                        callback_.clear();
+                        return guard([&] {
+                                model_->optimize();
+                                switch (model_->get(GRB_IntAttr_Status)) {
+                                        case GRB_OPTIMAL: return Status::OPTIMAL;
+                                        case GRB_INF_OR_UNBD:
+                                        case GRB_INFEASIBLE: return Status::INFEASIBLE;
+                                        case GRB_CUTOFF: return Status::CUTOFF;
+                                        case GRB_TIME_LIMIT: return Status::TIME_LIMIT;
+                                        case GRB_SOLUTION_LIMIT: return Status::SOLUTION_LIMIT;
+                                        case GRB_INTERRUPTED: return Status::INTERRUPTED;
+                                        default: return Status::OTHER;
+                                }
+                        });
+                }
+
+                void terminate() override {
+                        callback_.terminate_requested = true;
+                        guard([this] { model_->terminate(); });
+                }
+
+                [[nodiscard]] double obj_val() const override {
+                        return guard([&] {
+                                if (model_->get(GRB_IntAttr_SolCount) == 0) {
+                                        return std::numeric_limits<double>::max();
+                                }
+                                return model_->get(GRB_DoubleAttr_ObjVal);
+                        });
+                }
+
+                [[nodiscard]] double obj_bound() const override {
+                        return guard([&] { return model_->get(GRB_DoubleAttr_ObjBound); });
+                }
+
+                [[nodiscard]] double root_bound() const override { return callback_.root_bound; }
+
+                [[nodiscard]] double root_time() const override { return callback_.root_time; }
+
+                [[nodiscard]] double value(int var) const override {
+                        return guard([&] { return vars_[var].get(GRB_DoubleAttr_X); });
+                }
+
+                [[nodiscard]] double reduced_cost(int var) const override {
+                        return guard([&] { return vars_[var].get(GRB_DoubleAttr_RC); });
+                }
+
+                [[nodiscard]] double node_count() const override {
+                        return guard([&] { return model_->get(GRB_DoubleAttr_NodeCount); });
+                }
+
+                [[nodiscard]] double mip_gap() const override {
+                        return guard([&] { return model_->get(GRB_DoubleAttr_MIPGap); });
+                }
+
+                [[nodiscard]] double runtime() const override {
+                        return guard([&] { return model_->get(GRB_DoubleAttr_Runtime); });
+                }
+
+                [[nodiscard]] double iter_count() const override {
+                        return guard([&] { return model_->get(GRB_DoubleAttr_IterCount); });
+                }
+
+                [[nodiscard]] int num_vars() const override {
+                        return guard([&] { return model_->get(GRB_IntAttr_NumVars); });
+                }
+
+                [[nodiscard]] int num_constrs() const override {
+                        return guard([&] { return model_->get(GRB_IntAttr_NumConstrs); });
+                }
+
+                [[nodiscard]] int num_nz() const override {
+                        return guard([&] { return model_->get(GRB_IntAttr_NumNZs); });
+                }
+        };
+
+} // namespace solver
+
+#endif //FORI_WITH_GUROBI
+
+#endif //GEDC_GUROBI_SOLVER_HPP
@@ -0,0 +1,282 @@
+#ifndef GEDC_HIGHS_SOLVER_HPP
+#define GEDC_HIGHS_SOLVER_HPP
+
+#ifdef FORI_WITH_HIGHS
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+
+#include "Highs.h"
+#include "solver/MIPSolver.hpp"
+
+namespace solver {
+
+        /**
+         * MIPSolver backed by the open source solver HiGHS, built from ext/HiGHS with -DFORI_WITH_HIGHS=ON.
+         * HiGHS has no per-variable start attribute, the start values are collected and handed over as one solution
+         * right before optimize(). Variable and constraint names are not passed on, HiGHS does not need them.
+         */
+        class HighsSolver : public MIPSolver {
+        private:
+                /// mutable since Highs::getRunTime() is not const
+                mutable Highs highs_;
+                std::vector<bool> integer_;
+                std::vector<double> start_;
+                bool has_start_ = false;
+                bool mip_ = false;
+                /// set by terminate(), polled by the interrupt callbacks, stays set until reset()
+                std::atomic<bool> interrupt_{false};
+                Status status_ = Status::OTHER;
+
+                inline void check(HighsStatus status, const std::string &what) const {
+                        if (status == HighsStatus::kError) {
+                                throw std::runtime_error("HiGHS error in " + what);
+                        }
+                }
+
+                template<typename V>
+                inline void set_option(const std::string &option, V value) {
+                        check(highs_.setOptionValue(option, value), "setOptionValue(" + option + ")");
+                }
+
+        public:
+                HighsSolver() {
+                        set_option("output_flag", false);
+                        check(highs_.setCallback([](int, const std::string &, const HighsCallbackDataOut *, HighsCallbackDataIn *data_in, void *self) {
+                                if (data_in != nullptr and static_cast<HighsSolver *>(self)->interrupt_.load()) {
+                                        data_in->user_interrupt = true;
+                                }
+                        }, this), "setCallback");
+                        check(highs_.startCallback(kCallbackSimplexInterrupt), "startCallback");
+                        check(highs_.startCallback(kCallbackIpmInterrupt), "startCallback");
+                        check(highs_.startCallback(kCallbackMipInterrupt), "startCallback");
+                }
+
+                [[nodiscard]] std::string name() const override { return "highs"; }
+
+                /// HiGHS adds every column as continuous, an integer variable is declared right away, like the BINARY vtype of gurobi
+                int add_var(double lb, double ub, double obj, bool integer, const std::string &) override {
+                        check(highs_.addCol(obj, lb, ub, 0, nullptr, nullptr), "addCol");
+                        const auto col = static_cast<HighsInt>(integer_.size());
+                        if (integer) {
+                                check(highs_.changeColIntegrality(col, HighsVarType::kInteger), "changeColIntegrality");
+                                mip_ = true;
+                        }
+                        integer_.push_back(integer);
+                        start_.push_back(0.0);
+                        return static_cast<int>(col);
+                }
+
+                void add_constr(const LinExpr &lhs, Sense sense, double rhs, const std::string &name) override {
+                        double lower = sense == Sense::LESS_EQUAL ? -kHighsInf : rhs;
+                        double upper = sense == Sense::GREATER_EQUAL ? kHighsInf : rhs;
+                        check(highs_.addRow(lower, upper, static_cast<HighsInt>(lhs.size()), lhs.vars.data(), lhs.coefs.data()), "addRow " + name);
+                }
+
+                void set_obj_constant(double constant) override {
+                        check(highs_.changeObjectiveOffset(constant), "changeObjectiveOffset");
+                }
+
+                void set_integrality(bool integer) override {
+                        mip_ = integer and std::find(integer_.begin(), integer_.end(), true) != integer_.end();
+                        std::vector<HighsVarType> types(integer_.size(), HighsVarType::kContinuous);
+                        for (std::size_t v = 0; v < integer_.size(); v++) {
+                                if (integer and integer_[v]) {
+                                        types[v] = HighsVarType::kInteger;
+                                }
+                        }
+                        if (!types.empty()) {
+                                check(highs_.changeColsIntegrality(0, static_cast<HighsInt>(types.size()) - 1, types.data()), "changeColsIntegrality");
+                        }
+                }
+
+                void set_ub(int var, double ub) override {
+                        check(highs_.changeColBounds(var, highs_.getLp().col_lower_[var], ub), "changeColBounds");
+                }
+
+                [[nodiscard]] double get_ub(int var) const override {
+                        return highs_.getLp().col_upper_[var];
+                }
+
+                void set_start(int var, double value) override {
+                        start_[var] = value;
+                        has_start_ = true;
+                }
+
+                void update() override {}
+
+                void reset() override {
+                        check(highs_.clearSolver(), "clearSolver");
+                        status_ = Status::OTHER;
+                        interrupt_ = false;
+                }
+
+                void set_model_name(const std::string &name) override {
+                        highs_.passModelName(name);
+                }
+
+                void set_log_file(const std::string &path) override {
+                        set_option("log_file", path);
+                }
+
+                void set_output(bool output) override {
+                        set_option("output_flag", output);
+                }
+
+                void set_threads(int threads) override {
+                        set_option("threads", static_cast<HighsInt>(threads));
+                }
+
+                void set_time_limit(double seconds) override {
+                        set_option("time_limit", seconds);
+                }
+
+                void set_seed(int seed) override {
+                        set_option("random_seed", static_cast<HighsInt>(seed));
+                }
+
+                void set_solution_limit(int limit) override {
+                        set_option("mip_max_improving_sols", static_cast<HighsInt>(limit));
+                }
+
+                void set_mip_gap(double gap) override {
+                        set_option("mip_rel_gap", gap);
+                }
+
+                // HiGHS has neither branching priorities nor hints nor a preferred direction
+
+                void set_branch_priority(int, int) override {}
+
+                void set_branch_hint(int, double) override {}
+
+                void set_branch_direction(int) override {}
+
+                void set_focus(Focus focus) override {
+                        set_option("mip_heuristic_effort", focus == Focus::FEASIBILITY ? 0.3 : (focus == Focus::BOUND ? 0.0 : 0.05));
+                }
+
+                void set_barrier(bool crossover) override {
+                        set_option("solver", std::string("ipm"));
+                        set_option("run_crossover", std::string(crossover ? "on" : "off"));
+                }
+
+                void set_lp_method(LpMethod method) override {
+                        set_option("solver", std::string(method == LpMethod::BARRIER ? "ipm" : method == LpMethod::AUTOMATIC ? "choose" : "simplex"));
+                        set_option("run_crossover", std::string("choose"));
+                        if (method == LpMethod::PRIMAL_SIMPLEX or method == LpMethod::DUAL_SIMPLEX) {
+                                set_option("simplex_strategy", static_cast<HighsInt>(method == LpMethod::PRIMAL_SIMPLEX ? 4 : 1));
+                        }
+                }
+
+                // HiGHS presolve is on or off, it has no levels and no switch for its cut separators
+
+                void set_presolve(int level) override {
+                        set_option("presolve", std::string(level == 0 ? "off" : level < 0 ? "choose" : "on"));
+                }
+
+                void set_cuts(int) override {}
+
+                void set_heuristics(double effort) override {
+                        set_option("mip_heuristic_effort", effort);
+                }
+
+                void set_cutoff(double cutoff) override {
+                        set_option("objective_bound", cutoff);
+                }
+
+                Status optimize() override {
+                        if (has_start_) {
+                                HighsSolution start;
+                                start.col_value = start_;
+                                start.value_valid = true;
+                                check(highs_.setSolution(start), "setSolution");
+                        }
+                        check(highs_.run(), "run");
+                        switch (highs_.getModelStatus()) {
+                                case HighsModelStatus::kOptimal: status_ = Status::OPTIMAL; break;
+                                case HighsModelStatus::kInfeasible:
+                                case HighsModelStatus::kUnboundedOrInfeasible: status_ = Status::INFEASIBLE; break;
+                                case HighsModelStatus::kObjectiveBound: status_ = Status::CUTOFF; break;
+                                case HighsModelStatus::kTimeLimit: status_ = Status::TIME_LIMIT; break;
+                                case HighsModelStatus::kSolutionLimit: status_ = Status::SOLUTION_LIMIT; break;
+                                case HighsModelStatus::kInterrupt: status_ = Status::INTERRUPTED; break;
+                                default: status_ = Status::OTHER;
+                        }
+                        return status_;
+                }
+
+                void terminate() override {
+                        interrupt_ = true;
+                }
+
+                [[nodiscard]] double obj_val() const override {
+                        if (highs_.getInfo().primal_solution_status != kSolutionStatusFeasible) {
+                                return std::numeric_limits<double>::max();
+                        }
+                        return highs_.getInfo().objective_function_value;
+                }
+
+                [[nodiscard]] double obj_bound() const override {
+                        if (status_ == Status::INFEASIBLE) {
+                                return std::numeric_limits<double>::max();
+                        }
+                        // the LP relaxation has no separate dual bound, its optimal value is the bound
+                        return mip_ ? highs_.getInfo().mip_dual_bound : highs_.getInfo().objective_function_value;
+                }
+
+                /// HiGHS does not report the root bound separately, for an LP or a solve stopped at the root it is the final bound
+                [[nodiscard]] double root_bound() const override {
+                        if (!mip_ or highs_.getInfo().mip_node_count <= 1) {
+                                return obj_bound();
+                        }
+                        return -std::numeric_limits<double>::infinity();
+                }
+
+                [[nodiscard]] double root_time() const override {
+                        return root_bound() > -std::numeric_limits<double>::infinity() ? runtime() : 0.0;
+                }
+
+                [[nodiscard]] double value(int var) const override {
+                        return highs_.getSolution().col_value[var];
+                }
+
+                [[nodiscard]] double reduced_cost(int var) const override {
+                        return highs_.getSolution().col_dual[var];
+                }
+
+                [[nodiscard]] double node_count() const override {
+                        return static_cast<double>(highs_.getInfo().mip_node_count);
+                }
+
+                [[nodiscard]] double mip_gap() const override {
+                        return highs_.getInfo().mip_gap;
+                }
+
+                [[nodiscard]] double runtime() const override {
+                        return highs_.getRunTime();
+                }
+
+                [[nodiscard]] double iter_count() const override {
+                        return static_cast<double>(highs_.getInfo().simplex_iteration_count + highs_.getInfo().ipm_iteration_count);
+                }
+
+                [[nodiscard]] int num_vars() const override {
+                        return static_cast<int>(highs_.getNumCol());
+                }
+
+                [[nodiscard]] int num_constrs() const override {
+                        return static_cast<int>(highs_.getNumRow());
+                }
+
+                [[nodiscard]] int num_nz() const override {
+                        return static_cast<int>(highs_.getLp().a_matrix_.numNz());
+                }
+        };
+
+} // namespace solver
+
+#endif //FORI_WITH_HIGHS
+
+#endif //GEDC_HIGHS_SOLVER_HPP
@@ -0,0 +1,166 @@
+#ifndef GEDC_MIP_SOLVER_HPP
+#define GEDC_MIP_SOLVER_HPP
+
+#include <string>
+#include <vector>
+
+/**
+ * solver independent interface the verification models are built against.
+ * Variables are referred to by the index add_var() returned, all models are minimization problems.
+ */
+namespace solver {
+
+        enum class Sense { LESS_EQUAL, GREATER_EQUAL, EQUAL };
+
+        /// values match the gurobi status codes, so that opt.status_ == 2 still means solved to optimality
+        enum class Status { OTHER = 1, OPTIMAL = 2, INFEASIBLE = 3, CUTOFF = 6, TIME_LIMIT = 9, SOLUTION_LIMIT = 10, INTERRUPTED = 11 };
+
+        enum class Focus { BALANCED, FEASIBILITY, BOUND };
+
+        enum class LpMethod { AUTOMATIC, PRIMAL_SIMPLEX, DUAL_SIMPLEX, BARRIER };
+
+        /// sparse linear expression over variable indices
+        struct LinExpr {
+                std::vector<int> vars;
+                std::vector<double> coefs;
+
+                /// a variable that was not generated (negative index, see FORI_VERIFICATION's sparse models) is a zero term
+                inline void add(int var, double coef = 1.0) {
+                        if (var < 0) {
+                                return;
+                        }
+                        vars.push_back(var);
+                        coefs.push_back(coef);
+                }
+
+                inline void clear() {
+                        vars.clear();
+                        coefs.clear();
+                }
+
+                [[nodiscard]] inline std::size_t size() const { return vars.size(); }
+        };
+
+        class MIPSolver {
+        public:
+                virtual ~MIPSolver() = default;
+
+                [[nodiscard]] virtual std::string name() const = 0;
+
+                // ------------------- model -------------------------------------------------------------------------------
+
+                /// @brief adds a variable with objective coefficient obj, returns its index
+                virtual int add_var(double lb, double ub, double obj, bool integer, const std::string &name) = 0;
+
+                virtual void add_constr(const LinExpr &lhs, Sense sense, double rhs, const std::string &name) = 0;
+
+                virtual void set_obj_constant(double constant) = 0;
+
+                /// @brief switches all variables between continuous (LP relaxation) and their declared integrality
+                virtual void set_integrality(bool integer) = 0;
+
+                virtual void set_ub(int var, double ub) = 0;
+
+                [[nodiscard]] virtual double get_ub(int var) const = 0;
+
+                /// @brief value of var in the MIP start
+                virtual void set_start(int var, double value) = 0;
+
+                /// @brief variables with higher priority are branched on first, backends without priorities ignore it
+                virtual void set_branch_priority(int var, int priority) = 0;
+
+                /// @brief value var probably takes in a good solution, guides branching and heuristics, ignored where unsupported
+                virtual void set_branch_hint(int var, double value) = 0;
+
+                /// @brief flushes pending model modifications
+                virtual void update() = 0;
+
+                /// @brief discards the solution of the last optimize(), the model itself is kept
+                virtual void reset() = 0;
+
+                // ------------------- parameters --------------------------------------------------------------------------
+
+                virtual void set_model_name(const std::string &name) = 0;
+
+                virtual void set_log_file(const std::string &path) = 0;
+
+                virtual void set_output(bool output) = 0;
+
+                virtual void set_threads(int threads) = 0;
+
+                virtual void set_time_limit(double seconds) = 0;
+
+                virtual void set_seed(int seed) = 0;
+
+                /// @brief stop the MIP as soon as this many feasible solutions were found
+                virtual void set_solution_limit(int limit) = 0;
+
+                /// @brief relative gap at which the MIP stops, 0 solves to proven optimality
+                virtual void set_mip_gap(double gap) = 0;
+
+                /// @brief solve LPs with an interior point method, optionally without crossover to a basic solution
+                virtual void set_barrier(bool crossover) = 0;
+
+                /// @brief algorithm of the root LP, overrides set_barrier(); crossover is left at the solver default
+                virtual void set_lp_method(LpMethod method) = 0;
+
+                /// @brief presolve level: -1 solver default, 0 off, 1 conservative, 2 aggressive
+                virtual void set_presolve(int level) = 0;
+
+                /// @brief cut generation: -1 solver default, 0 off, 1 moderate, 2 aggressive
+                virtual void set_cuts(int level) = 0;
+
+                /// @brief share of the MIP effort spent in primal heuristics, in [0, 1]
+                virtual void set_heuristics(double effort) = 0;
+
+                /// @brief the MIP stops as soon as its bound proves that no solution with objective <= cutoff exists (status CUTOFF)
+                virtual void set_cutoff(double cutoff) = 0;
+
+                /// @brief what the search puts its effort into, finding solutions or improving the bound
+                virtual void set_focus(Focus focus) = 0;
+
+                /// @brief child explored first after branching: -1 down (to 0), 1 up (to 1), 0 solver default
+                virtual void set_branch_direction(int direction) = 0;
+
+                // ------------------- solving -----------------------------------------------------------------------------
+
+                virtual Status optimize() = 0;
+
+                /// @brief asks optimize() to stop as soon as possible, it then returns INTERRUPTED; may be called from another thread.
+                /// A request made before optimize() started stops it right away, until reset()
+                virtual void terminate() = 0;
+
+                /// @brief objective value of the best solution found, std::numeric_limits<double>::max() if there is none
+                [[nodiscard]] virtual double obj_val() const = 0;
+
+                [[nodiscard]] virtual double obj_bound() const = 0;
+
+                /// @brief bound after the root relaxation of the last MIP solve, -infinity if the solve ended before the root was solved
+                [[nodiscard]] virtual double root_bound() const = 0;
+
+                /// @brief runtime until root_bound() was known
+                [[nodiscard]] virtual double root_time() const = 0;
+
+                [[nodiscard]] virtual double value(int var) const = 0;
+
+                /// @brief reduced cost of var in the last LP solution
+                [[nodiscard]] virtual double reduced_cost(int var) const = 0;
+
+                [[nodiscard]] virtual double node_count() const = 0;
+
+                [[nodiscard]] virtual double mip_gap() const = 0;
+
+                [[nodiscard]] virtual double runtime() const = 0;
+
+                [[nodiscard]] virtual double iter_count() const = 0;
+
+                [[nodiscard]] virtual int num_vars() const = 0;
+
+                [[nodiscard]] virtual int num_constrs() const = 0;
+
+                [[nodiscard]] virtual int num_nz() const = 0;
+        };
+
+} // namespace solver
+
+#endif //GEDC_MIP_SOLVER_HPP
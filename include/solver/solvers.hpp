@@ -0,0 +1,71 @@
+#ifndef GEDC_SOLVERS_HPP
+#define GEDC_SOLVERS_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "solver/MIPSolver.hpp"
+#include "solver/GurobiSolver.hpp"
+#include "solver/HighsSolver.hpp"
+
+namespace solver {
+
+        /// @brief names of the backends compiled into this binary, the first one is the default of -b/--backend
+        inline std::string available_backends() {
+                std::string backends;
+#ifdef FORI_WITH_GUROBI
+                backends += "gurobi ";
+#endif
+#ifdef FORI_WITH_HIGHS
+                backends += "highs ";
+#endif
+                return backends;
+        }
+
+        /**
+         * solver environment of one worker, reused by every model it builds: gurobi checks the license and sets up an
+         * environment once per worker instead of once per pair. The models keep the environment alive. An environment
+         * must not be used by two threads at the same time, so it can not be copied and concurrent models (race) need
+         * one each. HiGHS has no environment.
+         */
+        class environment {
+        public:
+                environment() = default;
+                environment(const environment &) = delete;
+                environment &operator=(const environment &) = delete;
+                environment(environment &&) = default;
+                environment &operator=(environment &&) = default;
+
+#ifdef FORI_WITH_GUROBI
+                /// @brief the gurobi environment, started by the first model
+                std::shared_ptr<GRBEnv> gurobi() {
+                        if (!gurobi_) {
+                                gurobi_ = GurobiSolver::make_env();
+                        }
+                        return gurobi_;
+                }
+
+        private:
+                std::shared_ptr<GRBEnv> gurobi_;
+#endif
+        };
+
+        /// @brief creates the backend selected with -b/--backend in env, throws if it was not compiled in
+        inline std::unique_ptr<MIPSolver> make_solver(const std::string &backend, environment &env) {
+#ifdef FORI_WITH_GUROBI
+                if (backend == "gurobi") {
+                        return std::make_unique<GurobiSolver>(env.gurobi());
+                }
+#endif
+#ifdef FORI_WITH_HIGHS
+                if (backend == "highs") {
+                        return std::make_unique<HighsSolver>();
+                }
+#endif
+                throw std::runtime_error("make_solver: backend " + backend + " is not available, this binary was built with: " + available_backends());
+        }
+
+} // namespace solver
+
+#endif //GEDC_SOLVERS_HPP
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "auxiliary/io.hpp"
+#include "engine/search_cli.hpp"
+#include "engine/similarity_search.hpp"
+
+namespace {
+        std::vector<std::string> read_query_list(const std::string &path) {
+                std::ifstream in(path);
+                if (!in) {
+                        throw std::runtime_error("can not read the query list " + path);
+                }
+                std::vector<std::string> queries;
+                for (std::string line; std::getline(in, line);) {
+                        if (!line.empty()) {
+                                queries.push_back(line);
+                        }
+                }
+                return queries;
+        }
+
+        /// one output per threshold, a sweep reads the smaller thresholds off the bounds of the candidates. A top-k search only
+        /// ran at the largest threshold, its radius.
+        void write_outputs(const options &opt, const std::string &write_path) {
+                const std::vector<double> thresholds = opt.top_k_ > 0 ? std::vector<double>{opt.threshold} : opt.thresholds;
+                for (double t: thresholds) {
+                        options out = thresholds.size() > 1 ? IO::threshold_output(opt, t) : opt;
+                        out.output_ = IO::create_verification_output(out);
+                        std::ostringstream stream;
+                        stream << std::fixed << std::setprecision(2) << t;
+                        std::string str_threshold = stream.str();
+                        out.output_fname_ = write_path + "/" + opt.Q_id_ + "_" + opt.dataset_name_ + "_" + opt.formulation_name_ +
+                                            +"_" + std::to_string(opt.seed_) + "_" + str_threshold + (opt.flat ? "_flat" : "") + (opt.warmstart_ ? "_warm" : "") +
+                                            (opt.solver_backend_ != "gurobi" ? "_" + opt.solver_backend_ : "")
+                                            + (opt.branchPrio_ ? "_branch" + std::to_string(opt.branchPrio_) : "")
+                                            + (opt.branchDirection_ ? "_dir" + std::to_string(opt.branchDirection_) : "") + (opt.race_ ? "_race" : "")
+                                            + (opt.batch_size_ > 1 ? "_batch" + std::to_string(opt.batch_size_) : "")
+                                            + (opt.top_k_ > 0 ? "_top" + std::to_string(opt.top_k_) : "")
+                                            + (opt.preprocessing_ ? "_YESpre" : "_NOpre") + (opt.uniform_costs_ ? "uniform" : "non-uniform") + ".json";
+                        IO::writeJsonToFile(out);
+                }
+        }
+}
+
+void add_search_options(cxxopts::Options &opts, const std::string &archive) {
+        opts.add_options()
+                ("f, formulation", "which LP Formulation to use", cxxopts::value<std::string>())(
+                "t, threads", "number of threads", cxxopts::value<int>()->default_value("1"))(
+                "workers", "number of verification ILPs solved concurrently, each gets threads / workers solver threads", cxxopts::value<int>()->default_value("1"))(
+                "l, timelimit", "number of seconds the solver is allowed to run for", cxxopts::value<double>()->default_value("900"))(
+                "r, seed", "random seed", cxxopts::value<int>()->default_value("1"))(
+                "solutionFile", "absolute path to a .gedsol file for the corresponding instance. throws runtime error if file doesn't correspond to graph1id_graph2id", cxxopts::value<std::string>()->default_value(""))(
+                "flat, flatConstraint", "Set to 1 if model with flat constraint", cxxopts::value<bool>()->default_value("false"))(
+                "p, preprocessing", "Set to 1 to use preprocessing before running gurobi", cxxopts::value<bool>()->default_value("false"))(
+                "heuristic", "Set to 1 to use the GEDLIB heuristic (implies preprocessing)", cxxopts::value<bool>()->default_value("false"))(
+                "u, uniformCosts", "Set to 1 if uniform edit costs should be used, 0 otherwise", cxxopts::value<bool>()->default_value("false"))(
+                "m, warmStart", "Set to 1 to warm start the ILP from the node map of the GEDLIB upper bound", cxxopts::value<bool>()->default_value("false"))(
+                "c, reducedCostFixing", "Set to 0 to disable fixing node variables with the reduced costs of the Lagrangian bound, which is computed for this even with -g 0; edge variables are fixed through their end nodes", cxxopts::value<bool>()->default_value("true"))(
+                "sparseVariables", "Set to 0 to generate x_ik even if substituting i by k alone exceeds the threshold", cxxopts::value<bool>()->default_value("true"))(
+                "b, backend", "MIP solver for the verification ILP (gurobi or highs)", cxxopts::value<std::string>()->default_value("gurobi"))(
+                "g, lagrangian", "Set to 0 to disable rejecting pairs with the Lagrangian bound before the ILP, with -c 1 the bound is still computed for fixing", cxxopts::value<bool>()->default_value("true"))(
+                "lagrangianIterations", "number of subgradient iterations of the Lagrangian bound, at least 1", cxxopts::value<int>()->default_value("30"))(
+                "branchPriority", "branching order: 0 solver default, 1 node variables first, 2 label rarity, 3 fractional degree, 4 objective coefficient", cxxopts::value<int>()->default_value("0"))(
+                "branchDirection", "0 solver default, 1 down branch first, 2 up branch first, 3 hint the warm start mapping", cxxopts::value<int>()->default_value("0"))(
+                "objCoefTiebreak", "Set to 1 to break ties of branchPriority 2 and 3 by the objective coefficient", cxxopts::value<bool>()->default_value("false"))(
+                "boundCache", "file of GED bounds shared by all runs and thresholds, pairs it already decides are skipped", cxxopts::value<std::string>()->default_value(""))(
+                "solverProfile", "solver parameters per model size written by tune_verification for this dataset and cost model", cxxopts::value<std::string>()->default_value(""))(
+                "snapshot", "dataset snapshot written by convert_snapshot, loaded instead of parsing the GXL files", cxxopts::value<std::string>()->default_value(""))(
+                "archive", "zip archive of the GXL files, parsed without extracting it (\"\" or a missing file reads the extracted folder)", cxxopts::value<std::string>()->default_value(archive))(
+                "race", "Set to 1 to race a feasibility and a bound focused copy of every verification ILP, each with half of the threads", cxxopts::value<bool>()->default_value("false"))(
+                "batch", "Solve up to this many tiny verification ILPs together as one block-diagonal model (0: one model per pair)", cxxopts::value<int>()->default_value("0"))(
+                "batchVars", "variable budget of a batch, pairs with more than a quarter of it are solved alone", cxxopts::value<int>()->default_value("20000"));
+}
+
+options parse_search_options(const cxxopts::ParseResult &arguments) {
+        const int branchPriority = arguments["branchPriority"].as<int>();
+        const int branchDirection = arguments["branchDirection"].as<int>();
+        options opt;
+        opt.seed_ = arguments["seed"].as<int>();
+        opt.timelimit_ = arguments["timelimit"].as<double>();
+        opt.threads_ = arguments["threads"].as<int>();
+        opt.workers_ = std::max(1, arguments["workers"].as<int>());
+        opt.formulation_name_ = arguments["formulation"].as<std::string>();
+        opt.solutionFilePath_ = arguments["solutionFile"].as<std::string>();
+        opt.flat = true;
+
+        opt.preprocessing_ = arguments["preprocessing"].as<bool>();
+        opt.heuristic_ = arguments["heuristic"].as<bool>();
+        if (opt.heuristic_) {
+                opt.preprocessing_ = true;
+        }
+        opt.uniform_costs_ = arguments["uniformCosts"].as<bool>();
+        opt.warmstart_ = arguments["warmStart"].as<bool>();
+        opt.reduced_cost_fixing_ = arguments["reducedCostFixing"].as<bool>();
+        opt.sparse_variables_ = arguments["sparseVariables"].as<bool>();
+        opt.solver_backend_ = arguments["backend"].as<std::string>();
+        opt.lagrangian_ = arguments["lagrangian"].as<bool>();
+        opt.lagrangian_iterations_ = arguments["lagrangianIterations"].as<int>();
+        if (opt.lagrangian_iterations_ < 1) {
+                // without an iteration the Lagrangian bound is -inf and decides nothing, use --lagrangian false instead
+                throw std::runtime_error("--lagrangianIterations has to be at least 1");
+        }
+        if (branchPriority < 0 or branchPriority > 4 or branchDirection < 0 or branchDirection > 3) {
+                throw std::runtime_error("--branchPriority has to be in 0..4 and --branchDirection in 0..3");
+        }
+        opt.branchPrio_ = branchPriority;
+        opt.branchDirection_ = branchDirection;
+        opt.includeObjCoefIntoFracDegreeBranch = arguments["objCoefTiebreak"].as<bool>();
+        opt.race_ = arguments["race"].as<bool>();
+        opt.bound_cache_path_ = arguments["boundCache"].as<std::string>();
+        opt.solver_profile_path_ = arguments["solverProfile"].as<std::string>();
+        opt.snapshot_path_ = arguments["snapshot"].as<std::string>();
+        opt.batch_size_ = arguments["batch"].as<int>();
+        opt.batch_vars_ = arguments["batchVars"].as<int>();
+        return opt;
+}
+
+template<typename Traits>
+int similarity_search_main(int argc, char **argv) {
+        try {
+                cxxopts::Options opts("experiment", "calc GED with given formulation, different branching priorities possible");
+                add_search_options(opts, Traits::archive);
+                opts.add_options()
+                        ("s, size", "number of query graphs", cxxopts::value<int>()->default_value("100"))(
+                        "v, verificationThreshold", "Set the graph similarity search threshold, a comma separated list sweeps several thresholds in one run", cxxopts::value<std::vector<double>>()->default_value("1"))(
+                        "w, writeInFolder", "path in which to write solution file", cxxopts::value<std::string>()->default_value(""))(
+                        "queries", "file with one query graph file per line, replaces the built-in or randomly selected queries", cxxopts::value<std::string>()->default_value(""))(
+                        "topK", "search the k nearest graphs of every query within the largest threshold instead of all graphs within it (0: range search)", cxxopts::value<int>()->default_value("0"));
+
+                auto arguments = opts.parse(argc, argv);
+                const std::string writePath = arguments["writeInFolder"].as<std::string>();
+                const std::string queryList = arguments["queries"].as<std::string>();
+                const int topK = arguments["topK"].as<int>();
+                std::vector<double> thresholds = arguments["verificationThreshold"].as<std::vector<double>>();
+                if (std::any_of(thresholds.begin(), thresholds.end(), [](double t) { return !(t >= 0); })) {
+                        throw std::runtime_error("--verificationThreshold has to be at least 0");
+                }
+                std::sort(thresholds.begin(), thresholds.end());
+                thresholds.erase(std::unique(thresholds.begin(), thresholds.end()), thresholds.end());
+                options opt = parse_search_options(arguments);
+                opt.size = arguments["size"].as<int>();
+                // the largest threshold caps the bounds and the ILP, the smaller ones are read off the proven bounds of every pair
+                opt.threshold = thresholds.back();
+                opt.thresholds = thresholds;
+
+                SimilaritySearch<Traits> engine(opt, arguments["archive"].as<std::string>());
+                const std::vector<std::string> querygraphs = queryList.empty() ? engine.default_queries(opt.size, opt.seed_) : read_query_list(queryList);
+                if (topK > 0) {
+                        std::vector<nearest_graph> nearest;
+                        for (std::size_t k = 0; k < querygraphs.size(); k++) {
+                                std::cout << "Query graph " << k + 1 << std::endl;
+                                engine.top_k(querygraphs[k], topK, opt.threshold, nearest);
+                                write_outputs(opt, writePath);
+                        }
+                } else {
+                        engine.search(querygraphs, [&](const options &result) { write_outputs(result, writePath); });
+                }
+        }
+        catch (std::exception &e) {
+                std::cout << "exception " << e.what() << std::endl;
+                return 1;
+        }
+
+        return 0;
+}
+
+template int similarity_search_main<aids_traits>(int argc, char **argv);
+template int similarity_search_main<muta_traits>(int argc, char **argv);
+template int similarity_search_main<protein_traits>(int argc, char **argv);
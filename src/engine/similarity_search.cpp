@@ -0,0 +1,769 @@
+#define GXL_GEDLIB_SHARED
+
+#include "src/env/ged_env.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <unordered_set>
+
+#include "auxiliary/bound_cache.hpp"
+#include "auxiliary/dataset_registry.hpp"
+#include "auxiliary/filter_tiles.hpp"
+#include "auxiliary/gedlib_costs.hpp"
+#include "auxiliary/memory.hpp"
+#include "auxiliary/solver_profile.hpp"
+#include "auxiliary/worker_pool.hpp"
+#include "engine/similarity_search.hpp"
+#include "gurobi/FORI_VERIFICATION.hpp"
+#include "gurobi/verification_pool.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+        /// context of bound_cache and solver_profile, e.g. "aids/uniform"
+        std::string cost_context(const options &opt) {
+                return opt.dataset_name_ + (opt.uniform_costs_ ? "/uniform" : "/non-uniform");
+        }
+}
+
+template<typename Traits>
+struct SimilaritySearch<Traits>::state {
+        using T = node_label;
+        using U = edge_label;
+
+        options &opt;
+        Database db;
+        dataset_registry registry;
+        ged::GEDEnv<ged::GXLNodeID, ged::GXLLabel, ged::GXLLabel> env;
+        /// bounds of earlier runs at any threshold, keyed by dataset and cost model
+        std::unique_ptr<bound_cache> cache;
+        /// one verifier for the whole run, it keeps its buffers between pairs
+        FORI_VERIFICATION<T, U> ilp;
+        /// with opt.workers_ > 1 the pairs that need an ILP are solved concurrently by verifiers of their own, ilp only
+        /// solves batches
+        std::unique_ptr<verification_pool<T, U>> pool;
+        /// every queued pair holds a copy of the query with its edit costs, a flush after a few hundred pairs per worker
+        /// bounds that memory; the pairs are ordered by difficulty within a flush, so it usually covers the whole query
+        std::size_t pool_capacity;
+        /// pairs queued in the batch model of ilp, as (index into the bounds, index into verification_times, candidate id)
+        std::vector<std::tuple<std::size_t, std::size_t, std::uint32_t>> batched;
+        /// pairs queued in the worker pool, as (index into the bounds, index into verification_times and graphlist, candidate id)
+        std::vector<std::tuple<std::size_t, std::size_t, std::uint32_t>> pooled;
+        std::uint32_t query_id = 0;
+        /// bound_cache of the current query, none for queries outside the collection
+        bound_cache *query_cache = nullptr;
+        /// hooks of the current query, none for search()
+        const query_control *control = nullptr;
+        /// label and degree signatures of the database graphs, built by the first query and kept for all later ones
+        filter_index<T, U> filter;
+        std::vector<filter_signature> candidate_signatures;
+
+        state(options &opt, const std::string &archive)
+                : opt(opt), db(load(opt, archive)), registry(Traits::collection), ilp(opt),
+                  pool_capacity(256 * static_cast<std::size_t>(std::max(1, opt.workers_))) {
+                std::cout << "loaded " << db.size() << " graphs in " << db.load_time() << "s" << std::endl;
+                // file names, ids and GEDLIB GraphIDs of the collection's graphs, read once and shared by every stage
+                registry.bind(db);
+                if (db.size() != registry.size()) {
+                        throw std::runtime_error("the dataset holds " + std::to_string(db.size()) + " graphs, " + Traits::collection + " lists " +
+                                                 std::to_string(registry.size()));
+                }
+
+                std::vector<std::string> attributes = Traits::irrelevant_attributes();
+                std::unordered_set<std::string> irrelevant_attributes(attributes.begin(), attributes.end());
+                registry.set_gedlib_ids(env.load_gxl_graphs(Traits::gedlib_folder, Traits::collection, ged::Options::GXLNodeEdgeType::LABELED,
+                                                            ged::Options::GXLNodeEdgeType::LABELED, irrelevant_attributes));
+                if (Traits::costs == gedlib_cost_model::protein) {
+                        env.set_edit_costs(ged::Options::EditCosts::PROTEIN);
+                        env.set_method(ged::Options::GEDMethod::BRANCH);
+                } else if (opt.uniform_costs_) {
+                        env.set_edit_costs(ged::Options::EditCosts::CONSTANT);
+                        env.set_method(ged::Options::GEDMethod::BRANCH_UNIFORM);
+                } else {
+                        env.set_edit_costs(ged::Options::EditCosts::CHEM_2);
+                        env.set_method(ged::Options::GEDMethod::BRANCH);
+                }
+                env.init(ged::Options::InitType::EAGER_WITHOUT_SHUFFLED_COPIES);
+                env.init_method();
+
+                if (!opt.bound_cache_path_.empty()) {
+                        cache = std::make_unique<bound_cache>(opt.bound_cache_path_, cost_context(opt));
+                }
+                if (opt.workers_ > 1) {
+                        pool = std::make_unique<verification_pool<T, U>>(opt);
+                        std::cout << pool->workers() << " workers with " << verification_pool<T, U>::threads_per_model(opt) << " solver threads each" << std::endl;
+                }
+                if (!opt.solver_profile_path_.empty()) {
+                        auto profile = solver_profile::load(opt.solver_profile_path_);
+                        if (profile.context != cost_context(opt)) {
+                                throw std::runtime_error("--solverProfile was tuned for " + profile.context + ", not for " + cost_context(opt));
+                        }
+                        if (pool) {
+                                pool->set_profile(profile);
+                        }
+                        ilp.set_profile(std::move(profile));
+                }
+        }
+
+        /**
+         * every graph is parsed once (or read from a snapshot or the zip archive), queries and candidates are taken from the
+         * resident database. The candidates are the graphs of the collection whatever the source, as in a snapshot of
+         * convert_snapshot; the archives and folders also hold graphs GEDLIB does not load (e.g. molecule_test_1.gxl).
+         */
+        static Database load(options &opt, const std::string &archive) {
+                opt.dataset_name_ = Traits::name;
+                const bool from_archive = opt.snapshot_path_.empty() && !archive.empty() && fs::exists(archive);
+                const std::vector<std::string> files = dataset_registry::collection_files(Traits::collection);
+                Database db = !opt.snapshot_path_.empty() ? Database::from_snapshot(opt.snapshot_path_)
+                              : from_archive ? Database::from_zip(archive, Traits::parse, files)
+                              : Database(Traits::reader_folder, files, Traits::read);
+                opt.archive_path_ = from_archive ? archive : "";
+                opt.dataset_load_time_ = db.load_time();
+                return db;
+        }
+
+        /// a pair is decided once none of the thresholds lies in [lower, upper) of its proven bounds
+        [[nodiscard]] bool decided(double lower, double upper) const {
+                return std::none_of(opt.thresholds.begin(), opt.thresholds.end(), [&](double t) { return lower <= t && t < upper; });
+        }
+
+        /// @brief signatures of the database graphs for the cheap filter, built on first use
+        const std::vector<filter_signature> &database_signatures() {
+                if (candidate_signatures.size() != db.size()) {
+                        candidate_signatures.clear();
+                        candidate_signatures.reserve(db.size());
+                        for (std::size_t c = 0; c < db.size(); c++) {
+                                candidate_signatures.push_back(filter.signature(db.get(c)));
+                        }
+                }
+                return candidate_signatures;
+        }
+
+        void accept(const std::string &file) {
+                opt.accepted_graphs.push_back(file);
+                if (control && control->accepted) {
+                        control->accepted(file);
+                }
+        }
+
+        [[nodiscard]] bool cancelled() const { return control && control->cancelled && control->cancelled(); }
+
+        /// bounds of every candidate for the outputs of a sweep, aligned with opt.graphlist
+        void record(double cheap, double lower, double upper, bool reached_ilp) {
+                opt.candidate_cheap.push_back(cheap);
+                opt.candidate_lower.push_back(lower);
+                opt.candidate_upper.push_back(upper);
+                opt.candidate_ilp.push_back(reached_ilp);
+        }
+
+        /**
+         * solves the pending batch of query graph1. A block the batch could not decide (time limit) is verified alone with
+         * ged(), so it is not reported as rejected; this writes the edit costs of its pair into graph1.
+         */
+        void flush_batch(std::size_t k, graph<T, U> &graph1) {
+                const double threshold = opt.threshold;
+                auto batch_start = std::chrono::high_resolution_clock::now();
+                auto results = ilp.batch_solve();
+                auto batch_end = std::chrono::high_resolution_clock::now();
+                auto duration_batch = std::chrono::duration_cast<std::chrono::nanoseconds>(batch_end - batch_start).count();
+                opt.gurobi_times_[k] += duration_batch;
+                for (std::size_t b = 0; b < results.size(); b++) {
+                        const auto [bound, c, candidate] = batched[b];
+                        // every pair of the batch is charged an equal share of the solve
+                        opt.verification_times[c] += duration_batch / static_cast<long>(results.size());
+                        double lower = 0.0;
+                        double upper = std::numeric_limits<double>::max();
+                        if (results[b].decided) {
+                                // a decided block without a solution within the threshold has GED > threshold, also at threshold 0
+                                if (results[b].objval < threshold + 1e-9) {
+                                        upper = results[b].objval;
+                                } else {
+                                        lower = std::nextafter(threshold, std::numeric_limits<double>::max());
+                                }
+                                opt.upperbounds[bound] = results[b].objval;
+                                opt.lowerbounds[bound] = results[b].dualbound;
+                        } else {
+                                auto single_start = std::chrono::high_resolution_clock::now();
+                                graph<T, U> &graph2 = db.get(c);
+                                getGEDLIBcosts<T, U> edit_costs(&graph1, &graph2);
+                                edit_costs.getEditCosts(opt.uniform_costs_);
+                                graph2.releaseGEDLIBeditcosts();
+                                ilp.set_start_mapping({});
+                                ilp.ged(graph1, graph2);
+                                const auto single = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - single_start).count();
+                                opt.gurobi_times_[k] += single;
+                                opt.verification_times[c] += single;
+                                const bound_cache::entry proven = ilp.proven_bounds();
+                                lower = proven.lower;
+                                upper = proven.upper;
+                                opt.upperbounds[bound] = opt.objval_;
+                                opt.lowerbounds[bound] = opt.final_dualbound_;
+                                opt.vars_fixed[bound] = opt.vars_fixed_;
+                                opt.model_vars[bound] = opt.n_vars_full_;
+                                opt.model_constrs[bound] = opt.n_cons_full_;
+                                opt.lp_times[bound] = opt.lpreltime;
+                                opt.lagrangian_bounds[bound] = opt.lagrangian_bound_;
+                                opt.lagrangian_times[bound] = opt.lagrangian_time_;
+                                opt.root_bounds[bound] = opt.lprelval;
+                                opt.bb_nodes[bound] = opt.bbnodecount_;
+                                opt.race_winners[bound] = opt.race_winner_;
+                                opt.objval_ = std::numeric_limits<double>::max();
+                        }
+                        if (upper <= threshold + 1e-9) {
+                                accept(opt.graphlist[c]);
+                        }
+                        if (query_cache) {
+                                query_cache->add(query_id, candidate, lower, upper);
+                        }
+                        opt.candidate_lower[c] = std::max(opt.candidate_lower[c], lower);
+                        opt.candidate_upper[c] = std::min(opt.candidate_upper[c], upper);
+                }
+                batched.clear();
+        }
+
+        void flush_pool(std::size_t k) {
+                if (pooled.empty()) {
+                        return;
+                }
+                // query() changes the threshold between requests, the workers still hold the one of the constructor
+                pool->set_thresholds(opt.threshold, opt.thresholds);
+                auto pool_start = std::chrono::high_resolution_clock::now();
+                auto results = pool->solve();
+                auto pool_end = std::chrono::high_resolution_clock::now();
+                opt.steals_ += static_cast<int>(pool->steals());
+                opt.gurobi_times_[k] += std::chrono::duration_cast<std::chrono::nanoseconds>(pool_end - pool_start).count();
+                for (std::size_t p = 0; p < results.size(); p++) {
+                        const auto &r = results[p];
+                        const auto [b, c, candidate] = pooled[p];
+                        if (r.objval < opt.threshold + 1e-9) {
+                                accept(opt.graphlist[c]);
+                        }
+                        opt.accepted_by_heuristic_ += r.accepted_by_heuristic;
+                        opt.rejected_by_lagrangian_ += r.rejected_by_lagrangian;
+                        opt.lowerbounds[b] = r.dualbound;
+                        opt.upperbounds[b] = r.objval;
+                        opt.vars_fixed[b] = r.vars_fixed;
+                        opt.model_vars[b] = r.model_vars;
+                        opt.model_constrs[b] = r.model_constrs;
+                        opt.lp_times[b] = r.lp_time;
+                        opt.lagrangian_bounds[b] = r.lagrangian_bound;
+                        opt.lagrangian_times[b] = r.lagrangian_time;
+                        opt.root_bounds[b] = r.root_bound;
+                        opt.bb_nodes[b] = r.bb_nodes;
+                        opt.race_winners[b] = r.race_winner;
+                        if (query_cache) {
+                                query_cache->add(query_id, candidate, r.proven.lower, r.proven.upper);
+                        }
+                        opt.candidate_lower[c] = std::max(opt.candidate_lower[c], r.proven.lower);
+                        opt.candidate_upper[c] = std::min(opt.candidate_upper[c], r.proven.upper);
+                        opt.verification_times[c] += r.time;
+                }
+                pooled.clear();
+        }
+
+        void reset_query_results() {
+                opt.accepted_graphs.clear();
+                opt.verification_times.clear();
+                opt.upperbounds.clear();
+                opt.lowerbounds.clear();
+                opt.objval_ = std::numeric_limits<double>::max();
+                opt.gurobi_needed.clear();
+                opt.accepted_by_heuristic_ = 0;
+                opt.vars_fixed.clear();
+                opt.model_vars.clear();
+                opt.model_constrs.clear();
+                opt.lp_times.clear();
+                opt.lagrangian_bounds.clear();
+                opt.lagrangian_times.clear();
+                opt.rejected_by_lagrangian_ = 0;
+                opt.root_bounds.clear();
+                opt.bb_nodes.clear();
+                opt.race_winners.clear();
+                opt.decided_by_cache_ = 0;
+                opt.steals_ = 0;
+                opt.batch_sizes.clear();
+                opt.graphlist.clear();
+                opt.candidate_cheap.clear();
+                opt.candidate_lower.clear();
+                opt.candidate_upper.clear();
+                opt.candidate_ilp.clear();
+                opt.nearest_distances.clear();
+                opt.nearest_exact.clear();
+        }
+
+        /**
+         * installs the hooks of one query, whether it is a top-k search and its single threshold. The hooks are removed and
+         * the thresholds of the caller, e.g. those of a sweep, are restored when it returns or throws.
+         */
+        struct query_scope {
+                state &s;
+                std::vector<double> thresholds;
+
+                query_scope(state &s, const query_control &hooks, std::size_t top_k, double threshold) : s(s), thresholds(std::move(s.opt.thresholds)) {
+                        s.control = &hooks;
+                        s.opt.top_k_ = static_cast<int>(top_k);
+                        s.opt.thresholds = {threshold};
+                }
+
+                ~query_scope() {
+                        s.control = nullptr;
+                        s.opt.thresholds = std::move(thresholds);
+                }
+        };
+
+        /// @brief a copy of the query, the edit costs of its pairs are written into it
+        graph<T, U> query_graph(const std::string &file) {
+                const long q = db.index(file);
+                return q >= 0 ? db.get(q) : Traits::read(Traits::folder + file);
+        }
+
+        /**
+         * resets the results of the options for the query graph1 and selects its bound cache
+         * @return GEDLIB GraphID of the query, 0 if it has none
+         */
+        std::size_t begin_query(const graph<T, U> &graph1, const std::string &querygraph, std::optional<std::size_t> gedlib_query) {
+                query_cache = nullptr;
+                if (gedlib_query) {
+                        query_id = registry.id(registry.position(querygraph));
+                        query_cache = cache.get();
+                }
+                opt.Q_filename_ = graph1.get_graph_id();
+                opt.Q_id_ = querygraph;
+                opt.Q_num_nodes_ = std::to_string(graph1.number_of_nodes());
+                opt.Q_num_edges_ = std::to_string(graph1.number_of_edges());
+                reset_query_results();
+                return gedlib_query.value_or(0);
+        }
+
+        /// @brief drops the pairs queued in the batch model and the worker pool, e.g. when their query was cancelled
+        void discard_queued() {
+                ilp.batch_discard();
+                batched.clear();
+                if (pool) {
+                        pool->discard();
+                }
+                pooled.clear();
+        }
+
+        /// statistics of the ILP that ilp.ged() just solved, placeholders for a batched or pooled pair
+        void push_ilp_statistics() {
+                opt.lowerbounds.push_back(opt.final_dualbound_);
+                opt.upperbounds.push_back(opt.objval_);
+                opt.vars_fixed.push_back(opt.vars_fixed_);
+                opt.model_vars.push_back(opt.n_vars_full_);
+                opt.model_constrs.push_back(opt.n_cons_full_);
+                opt.lp_times.push_back(opt.lpreltime);
+                opt.lagrangian_bounds.push_back(opt.lagrangian_bound_);
+                opt.lagrangian_times.push_back(opt.lagrangian_time_);
+                opt.root_bounds.push_back(opt.lprelval);
+                opt.bb_nodes.push_back(opt.bbnodecount_);
+                opt.race_winners.push_back(opt.race_winner_);
+        }
+
+        void record_memory(std::size_t allocations_before) {
+                opt.allocations_ = memory::allocations() - allocations_before;
+                opt.peak_rss_kb_ = memory::peak_rss_kb();
+                opt.rss_kb_ = memory::current_rss_kb();
+        }
+
+        /**
+         * the cap of the cheap filter for threshold cap. Its bounds are integers, so one exceeds the threshold exactly if it
+         * exceeds floor(threshold); thresholds are never negative, they are checked when the options are parsed.
+         */
+        static unsigned int filter_cap(double cap) {
+                return static_cast<unsigned int>(std::floor(std::min(cap, static_cast<double>(std::numeric_limits<unsigned int>::max() - 1))));
+        }
+
+        /// @brief cheap lower bounds of graph1 against every database graph, capped at cap (empty without a cheap filter)
+        std::vector<unsigned int> cheap_bounds(const graph<T, U> &graph1, double cap) {
+                std::vector<unsigned int> cheap;
+                if constexpr (Traits::cheap_filter) {
+                        auto filter_start = std::chrono::high_resolution_clock::now();
+                        const auto &candidates = database_signatures();
+                        cheap = filter_index<T, U>::lower_bounds({filter.signature(graph1)}, candidates, filter_cap(cap)).front();
+                        opt.filter_time_ = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - filter_start).count();
+                }
+                return cheap;
+        }
+
+        /**
+         * verifies graph1 against every database graph as query k, cheap holds its cheap lower bounds (empty: no cheap
+         * filter). A query of the collection has a GEDLIB GraphID, the others skip GEDLIB and the bound cache.
+         * @return false if the query was cancelled, the pairs queued for the ILP are dropped then
+         */
+        bool verify(std::size_t k, graph<T, U> graph1, const std::string &querygraph, std::optional<std::size_t> gedlib_query,
+                    const std::vector<unsigned int> &cheap) {
+                const double threshold = opt.threshold;
+                const std::size_t gedlib_G = begin_query(graph1, querygraph, gedlib_query);
+                const bool gedlib_bounds = gedlib_query.has_value() && opt.preprocessing_;
+                const bool gedlib_map = gedlib_query.has_value() && opt.warmstart_;
+
+                const std::size_t allocations_before = memory::allocations();
+                memory::reset_peak_rss();
+                for (std::size_t c = 0; c < db.size(); c++) {
+                        if (cancelled()) {
+                                discard_queued();
+                                return false;
+                        }
+                        const std::string &file = db.file(c);
+                        graph<T, U> &graph2 = db.get(c);
+                        opt.graphlist.push_back(file);
+
+                        const std::size_t gedlib_H = registry.graph_gedlib_id(c);
+                        const auto candidate_id = db.id(c);
+
+                        auto start = std::chrono::high_resolution_clock::now();
+                        // best bounds known before the ILP, from the cache and the cheap lower bounds
+                        bound_cache::entry known;
+                        if (query_cache) {
+                                known = query_cache->find(query_id, candidate_id);
+                                if (decided(known.lower, known.upper)) {
+                                        if (known.upper <= threshold) {
+                                                accept(file);
+                                        }
+                                        record(known.lower, known.lower, known.upper, false);
+                                        opt.decided_by_cache_++;
+                                        auto cache_end = std::chrono::high_resolution_clock::now();
+                                        opt.verification_times.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(cache_end - start).count());
+                                        continue;
+                                }
+                        }
+                        const unsigned int lb = cheap.empty() ? 0 : cheap[c];
+                        known.lower = std::max(known.lower, static_cast<double>(lb));
+                        if (lb > threshold) {
+                                if (query_cache) {
+                                        query_cache->add(query_id, candidate_id, lb, std::numeric_limits<double>::max());
+                                }
+                                auto lb_compute_end = std::chrono::high_resolution_clock::now();
+                                auto duration_lb_compute = std::chrono::duration_cast<std::chrono::nanoseconds>(lb_compute_end - start);
+                                opt.preprocessing_times_[k] = duration_lb_compute.count();
+                                record(known.lower, known.lower, known.upper, false);
+                                opt.verification_times.push_back(opt.preprocessing_times_[k]);
+                                continue;
+                        }
+
+                        // a full batch is solved before the edit costs of this pair are written into graph1, as the blocks it
+                        // leaves undecided are verified alone with the costs of their own pair
+                        if (ilp.batchable(graph1, graph2) && !ilp.batch_has_room(graph1, graph2)) {
+                                flush_batch(k, graph1);
+                        }
+                        // the edit costs of the pair are only needed from here on
+                        getGEDLIBcosts<T, U> edit_costs(&graph1, &graph2);
+                        edit_costs.getEditCosts(opt.uniform_costs_);
+                        graph2.releaseGEDLIBeditcosts();
+                        if (gedlib_bounds || gedlib_map) {
+                                env.run_method(gedlib_G, gedlib_H);
+                        }
+                        if (gedlib_bounds) {
+                                double uniform = env.get_lower_bound(gedlib_G, gedlib_H);
+                                known.lower = std::max(known.lower, uniform);
+
+                                if (uniform > threshold) {
+                                        if (query_cache) {
+                                                query_cache->add(query_id, candidate_id, uniform, std::numeric_limits<double>::max());
+                                        }
+                                        opt.objval_ = threshold + 1;
+                                        auto prepro_end = std::chrono::high_resolution_clock::now();
+                                        auto duration_prepro = std::chrono::duration_cast<std::chrono::nanoseconds>(prepro_end - start);
+                                        opt.preprocessing_times_[k] += duration_prepro.count();
+                                        record(known.lower, known.lower, known.upper, false);
+                                        opt.verification_times.push_back(opt.preprocessing_times_[k]);
+                                        continue;
+                                }
+                        }
+                        auto end_heur = std::chrono::high_resolution_clock::now();
+                        auto duration_heur = std::chrono::duration_cast<std::chrono::nanoseconds>(end_heur - start);
+                        opt.preprocessing_times_[k] += duration_heur.count();
+
+                        opt.gurobi_needed.push_back(file);
+                        auto gurobi_start = std::chrono::high_resolution_clock::now();
+
+                        std::vector<int> start_map;
+                        if (gedlib_map) {
+                                start_map = getGEDLIBnodeMap(env, gedlib_G, gedlib_H);
+                        }
+                        bool queued = false;
+                        bool pooled_pair = false;
+                        if (pool && !ilp.batchable(graph1, graph2)) {
+                                if (pool->pending() >= pool_capacity) {
+                                        flush_pool(k);
+                                }
+                                // graph1 is copied with the edit costs of this pair, graph2 stays in the database until the flush
+                                // the GEDLIB upper bound and the lower bounds estimate how hard the ILP is, the hardest pairs start first
+                                double upper = known.upper;
+                                double mapped = std::numeric_limits<double>::max();
+                                if (gedlib_bounds || gedlib_map) {
+                                        mapped = env.get_upper_bound(gedlib_G, gedlib_H);
+                                        upper = std::min(upper, mapped);
+                                }
+                                // the GEDLIB upper bound is the cost of the start mapping, which only decides a pair below the
+                                // lowest threshold of a sweep and never in a top-k search
+                                const bool by_start_map = !start_map.empty() && opt.top_k_ == 0 && mapped <= (opt.thresholds.empty() ? threshold : opt.thresholds.front());
+                                pool->add(graph1, graph2, std::move(start_map), pool->difficulty(graph1, graph2, known.lower, upper, threshold, by_start_map));
+                                pooled_pair = true;
+                        } else {
+                                if (opt.warmstart_) {
+                                        ilp.set_start_mapping(std::move(start_map));
+                                }
+                                if (ilp.batchable(graph1, graph2)) {
+                                        queued = ilp.batch_add(graph1, graph2, file);
+                                } else {
+                                        ilp.ged(graph1, graph2);
+                                }
+                        }
+
+                        auto gurobi_end = std::chrono::high_resolution_clock::now();
+                        auto duration_gurobi = std::chrono::duration_cast<std::chrono::nanoseconds>(gurobi_end - gurobi_start);
+                        opt.gurobi_times_[k] += duration_gurobi.count();
+                        auto end = std::chrono::high_resolution_clock::now();
+                        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+
+                        if (queued) {
+                                // bounds and acceptance are filled in by flush_batch()
+                                batched.emplace_back(opt.upperbounds.size(), opt.verification_times.size(), candidate_id);
+                        } else if (pooled_pair) {
+                                // the statistics pushed below are placeholders, flush_pool() overwrites them
+                                pooled.emplace_back(opt.upperbounds.size(), opt.verification_times.size(), candidate_id);
+                        } else if (opt.objval_ < threshold + 1e-9) {
+                                accept(file);
+                        }
+                        push_ilp_statistics();
+                        bound_cache::entry proven;
+                        if (!queued && !pooled_pair) {
+                                proven = ilp.proven_bounds();
+                                if (query_cache) {
+                                        query_cache->add(query_id, candidate_id, proven.lower, proven.upper);
+                                }
+                        }
+                        record(known.lower, std::max(known.lower, proven.lower), std::min(known.upper, proven.upper), true);
+                        opt.verification_times.push_back(duration.count());
+                        opt.objval_ = std::numeric_limits<double>::max();
+                }
+
+                flush_batch(k, graph1);
+                flush_pool(k);
+
+                record_memory(allocations_before);
+                return true;
+        }
+
+        /// @brief single query at threshold with the hooks of control
+        bool query(graph<T, U> graph1, const std::string &name, std::optional<std::size_t> gedlib_query, double threshold, const query_control &hooks) {
+                opt.threshold = threshold;
+                opt.gurobi_times_.assign(1, 0);
+                opt.preprocessing_times_.assign(1, 0);
+                const std::vector<unsigned int> cheap = cheap_bounds(graph1, threshold);
+                query_scope scope(*this, hooks, 0, threshold);
+                return verify(0, std::move(graph1), name, gedlib_query, cheap);
+        }
+
+        /**
+         * the k database graphs nearest to graph1 with a GED of at most radius. The candidates are visited by increasing
+         * lower bound (cheap filter, bound cache) and the walk stops at the first one whose bound does not beat the k-th
+         * nearest graph found so far; every later candidate is at least as far. The distance of the k-th nearest graph is
+         * the threshold of the next ILP, so the bounds and the Lagrangian reject more pairs as the walk goes on. The ILPs
+         * are solved one after the other by ilp, each one tightens the threshold of the next, so the worker pool and the
+         * batch model are not used.
+         * @return false if the query was cancelled, nearest then holds the nearest graphs of the candidates visited so far
+         */
+        bool top_k(graph<T, U> graph1, const std::string &name, std::optional<std::size_t> gedlib_query, std::size_t k, double radius,
+                   std::vector<nearest_graph> &nearest, const query_control &hooks) {
+                opt.threshold = radius;
+                opt.gurobi_times_.assign(1, 0);
+                opt.preprocessing_times_.assign(1, 0);
+                const std::vector<unsigned int> cheap = cheap_bounds(graph1, radius);
+                query_scope scope(*this, hooks, k, radius);
+                const std::size_t gedlib_G = begin_query(graph1, name, gedlib_query);
+                const bool gedlib_bounds = gedlib_query.has_value() && opt.preprocessing_;
+                const bool gedlib_map = gedlib_query.has_value() && opt.warmstart_;
+                const std::size_t allocations_before = memory::allocations();
+                memory::reset_peak_rss();
+
+                // bounds known before any GEDLIB or ILP work, the order of the walk
+                std::vector<bound_cache::entry> known(db.size());
+                for (std::size_t c = 0; c < db.size(); c++) {
+                        if (query_cache) {
+                                known[c] = query_cache->find(query_id, db.id(c));
+                        }
+                        known[c].lower = std::max(known[c].lower, cheap.empty() ? 0.0 : static_cast<double>(cheap[c]));
+                }
+                std::vector<std::size_t> order(db.size());
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return known[a].lower < known[b].lower; });
+
+                nearest_heap heap(k, radius);
+
+                bool finished = true;
+                for (std::size_t c: order) {
+                        if (cancelled()) {
+                                finished = false;
+                                break;
+                        }
+                        bound_cache::entry pair = known[c];
+                        if (!heap.beats(pair.lower)) {
+                                break;
+                        }
+                        const std::string &file = db.file(c);
+                        graph<T, U> &graph2 = db.get(c);
+                        const auto candidate_id = db.id(c);
+                        const std::size_t gedlib_H = registry.graph_gedlib_id(c);
+                        opt.graphlist.push_back(file);
+                        auto start = std::chrono::high_resolution_clock::now();
+                        auto elapsed = [&] {
+                                return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+                        };
+
+                        if (pair.exact()) {
+                                heap.offer(file, pair.upper, true);
+                                record(known[c].lower, pair.lower, pair.upper, false);
+                                opt.decided_by_cache_++;
+                                opt.verification_times.push_back(elapsed());
+                                continue;
+                        }
+
+                        getGEDLIBcosts<T, U> edit_costs(&graph1, &graph2);
+                        edit_costs.getEditCosts(opt.uniform_costs_);
+                        graph2.releaseGEDLIBeditcosts();
+                        if (gedlib_bounds || gedlib_map) {
+                                env.run_method(gedlib_G, gedlib_H);
+                        }
+                        if (gedlib_bounds) {
+                                pair.lower = std::max(pair.lower, env.get_lower_bound(gedlib_G, gedlib_H));
+                                pair.upper = std::min(pair.upper, env.get_upper_bound(gedlib_G, gedlib_H));
+                                if (!heap.beats(pair.lower)) {
+                                        if (query_cache) {
+                                                query_cache->add(query_id, candidate_id, pair.lower, pair.upper);
+                                        }
+                                        opt.preprocessing_times_[0] += elapsed();
+                                        record(known[c].lower, pair.lower, pair.upper, false);
+                                        opt.verification_times.push_back(elapsed());
+                                        continue;
+                                }
+                        }
+                        opt.preprocessing_times_[0] += elapsed();
+
+                        // a known upper bound is reached by some edit path, the ILP below it is feasible
+                        opt.threshold = std::min(heap.cap(), pair.upper);
+                        opt.gurobi_needed.push_back(file);
+                        if (opt.warmstart_) {
+                                ilp.set_start_mapping(gedlib_map ? getGEDLIBnodeMap(env, gedlib_G, gedlib_H) : std::vector<int>());
+                        }
+                        auto gurobi_start = std::chrono::high_resolution_clock::now();
+                        ilp.ged(graph1, graph2);
+                        opt.gurobi_times_[0] += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - gurobi_start).count();
+                        push_ilp_statistics();
+                        const bound_cache::entry proven = ilp.proven_bounds();
+                        pair.lower = std::max(pair.lower, proven.lower);
+                        pair.upper = std::min(pair.upper, proven.upper);
+                        if (query_cache) {
+                                query_cache->add(query_id, candidate_id, pair.lower, pair.upper);
+                        }
+                        if (pair.upper < std::numeric_limits<double>::max()) {
+                                // the solver proves the optimum up to its tolerance, a time limit leaves an upper bound
+                                heap.offer(file, pair.upper, pair.lower >= pair.upper - 1e-6);
+                        }
+                        record(known[c].lower, pair.lower, pair.upper, true);
+                        opt.verification_times.push_back(elapsed());
+                        opt.objval_ = std::numeric_limits<double>::max();
+                }
+
+                nearest = heap.take_sorted();
+                opt.threshold = radius;
+                for (const auto &n: nearest) {
+                        opt.accepted_graphs.push_back(n.file);
+                        opt.nearest_distances.push_back(n.distance);
+                        opt.nearest_exact.push_back(n.exact);
+                }
+                record_memory(allocations_before);
+                return finished;
+        }
+};
+
+template<typename Traits>
+SimilaritySearch<Traits>::SimilaritySearch(options &opt, const std::string &archive) : state_(std::make_unique<state>(opt, archive)) {}
+
+template<typename Traits>
+SimilaritySearch<Traits>::~SimilaritySearch() = default;
+
+template<typename Traits>
+const typename SimilaritySearch<Traits>::Database &SimilaritySearch<Traits>::database() const {
+        return state_->db;
+}
+
+template<typename Traits>
+std::vector<std::string> SimilaritySearch<Traits>::default_queries(std::size_t count, int seed) const {
+        std::vector<std::string> queries = Traits::default_queries();
+        if (queries.empty()) {
+                queries = state_->db.select_random(count, Traits::query_min_nodes, Traits::query_max_nodes, seed);
+        }
+        return queries;
+}
+
+template<typename Traits>
+void SimilaritySearch<Traits>::search(const std::vector<std::string> &queries, const query_callback &on_query) {
+        auto &s = *state_;
+        auto &opt = s.opt;
+        opt.top_k_ = 0;
+        opt.gurobi_times_.assign(queries.size(), 0);
+        opt.preprocessing_times_.assign(queries.size(), 0);
+
+        std::vector<std::vector<unsigned int>> cheap_bounds(queries.size());
+        if constexpr (Traits::cheap_filter) {
+                // one pass over the database for all queries: the cheap lower bound of every pair is computed from label and
+                // degree signatures, tiles of candidates against tiles of queries, and the query loop only looks it up
+                auto filter_start = std::chrono::high_resolution_clock::now();
+                const auto &candidate_signatures = s.database_signatures();
+                std::vector<filter_signature> query_signatures;
+                for (const auto &querygraph: queries) {
+                        query_signatures.push_back(s.filter.signature(s.query_graph(querygraph)));
+                }
+                {
+                        worker_pool filter_pool(opt.workers_);
+                        cheap_bounds = filter_index<node_label, edge_label>::lower_bounds(query_signatures, candidate_signatures,
+                                                                                         state::filter_cap(opt.threshold), &filter_pool);
+                }
+                opt.filter_time_ = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - filter_start).count();
+                std::cout << "filtered " << queries.size() << " queries against " << s.db.size() << " graphs in " << opt.filter_time_ << "s" << std::endl;
+        }
+
+        for (std::size_t k = 0; k < queries.size(); k++) {
+                std::cout << "Query graph " << k + 1 << std::endl;
+                s.verify(k, s.query_graph(queries[k]), queries[k], s.registry.gedlib_id(queries[k]), cheap_bounds[k]);
+                on_query(opt);
+        }
+}
+
+template<typename Traits>
+bool SimilaritySearch<Traits>::query(const std::string &file, double threshold, const query_control &control) {
+        auto &s = *state_;
+        return s.query(s.query_graph(file), file, s.registry.gedlib_id(file), threshold, control);
+}
+
+template<typename Traits>
+bool SimilaritySearch<Traits>::query(graph<node_label, edge_label> query_graph, const std::string &name, double threshold, const query_control &control) {
+        return state_->query(std::move(query_graph), name, std::nullopt, threshold, control);
+}
+
+template<typename Traits>
+bool SimilaritySearch<Traits>::top_k(const std::string &file, std::size_t k, double radius, std::vector<nearest_graph> &nearest,
+                                     const query_control &control) {
+        auto &s = *state_;
+        return s.top_k(s.query_graph(file), file, s.registry.gedlib_id(file), k, radius, nearest, control);
+}
+
+template<typename Traits>
+bool SimilaritySearch<Traits>::top_k(graph<node_label, edge_label> query_graph, const std::string &name, std::size_t k, double radius,
+                                     std::vector<nearest_graph> &nearest, const query_control &control) {
+        return state_->top_k(std::move(query_graph), name, std::nullopt, k, radius, nearest, control);
+}
+
+template class SimilaritySearch<aids_traits>;
+template class SimilaritySearch<muta_traits>;
+template class SimilaritySearch<protein_traits>;
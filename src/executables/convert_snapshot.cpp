@@ -0,0 +1,88 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include "auxiliary/cxxopts.hpp"
+#include "auxiliary/GXLGraphReader.hpp"
+#include "auxiliary/graph_database.hpp"
+#include "auxiliary/dataset_registry.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * converts a GXL dataset, an extracted folder or the zip archive it is shipped in, into a binary snapshot that the
+ * prepro_verification executables load with --snapshot. The graphs are the ones listed in the collection XML (as used by
+ * GEDLIB), in the order of the collection. The snapshot is read back after writing and checked against the parsed graphs.
+ */
+
+template<typename T, typename U>
+int convert(const std::string &source, const std::vector<std::string> &files, const std::function<graph<T, U>(const std::string &)> &read,
+            const std::function<graph<T, U>(std::istream &)> &parse, const std::string &output) {
+    const bool zip = source.size() > 4 && source.compare(source.size() - 4, 4, ".zip") == 0;
+    GraphDatabase<T, U> db = zip ? GraphDatabase<T, U>::from_zip(source, parse, files) : GraphDatabase<T, U>(source, files, read);
+    std::cout << "parsed " << db.size() << " graphs in " << db.load_time() << "s" << std::endl;
+    db.save_snapshot(output);
+
+    auto snapshot = GraphDatabase<T, U>::from_snapshot(output);
+    std::cout << "loaded " << snapshot.size() << " graphs from " << output << " in " << snapshot.load_time() << "s" << std::endl;
+    if (snapshot.size() != db.size()) {
+        throw std::runtime_error("convert_snapshot: snapshot holds " + std::to_string(snapshot.size()) + " graphs, expected " + std::to_string(db.size()));
+    }
+    graph_snapshot mapped(output);
+    for (std::size_t g = 0; g < db.size(); g++) {
+        auto &a = db.get(g);
+        const auto &b = snapshot.get(g);
+        bool same = snapshot.file(g) == db.file(g) && snapshot.id(g) == db.id(g) && a.number_of_nodes() == b.number_of_nodes() &&
+                    a.number_of_edges() == b.number_of_edges() && a.get_edgelist() == b.get_edgelist() && a.get_dataset() == b.get_dataset();
+        for (node v = 0; same && v < a.number_of_nodes(); v++) {
+            same = a.get_node_label(v) == b.get_node_label(v);
+        }
+        for (idx ij = 0; same && ij < a.number_of_edges(); ij++) {
+            same = a.get_edge_label(ij) == b.get_edge_label(ij);
+        }
+        for (node v = 0; same && v < a.number_of_nodes(); v++) {
+            auto [first, last] = mapped.neighbors(g, v);
+            same = std::vector<node>(first, last) == a.get_neighbors(v);
+        }
+        if (!same) {
+            throw std::runtime_error("convert_snapshot: " + db.file(g) + " differs after reading the snapshot back");
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+        cxxopts::Options opts("convert_snapshot", "convert a GXL dataset into a binary snapshot for --snapshot");
+        opts.add_options()
+            ("d, dataset", "aids, muta or protein", cxxopts::value<std::string>())(
+            "g, gxl", "folder of the GXL files or zip archive of them", cxxopts::value<std::string>())(
+            "c, collection", "collection XML listing the graphs, e.g. data/collections/allAIDS.xml", cxxopts::value<std::string>())(
+            "o, output", "snapshot file to write", cxxopts::value<std::string>());
+
+        auto arguments = opts.parse(argc, argv);
+        const std::string dataset = arguments["dataset"].as<std::string>();
+        std::string source = arguments["gxl"].as<std::string>();
+        if (fs::is_directory(source) && source.back() != '/') {
+            source += '/';
+        }
+        const std::string output = arguments["output"].as<std::string>();
+        const std::vector<std::string> files = dataset_registry::collection_files(arguments["collection"].as<std::string>());
+
+        if (dataset == "aids") {
+            return convert<std::string, int>(source, files, GXLGraphReader::read_AIDS, GXLGraphReader::parse_AIDS, output);
+        }
+        if (dataset == "muta") {
+            return convert<std::string, int>(source, files, GXLGraphReader::read_mutagenicity, GXLGraphReader::parse_mutagenicity, output);
+        }
+        if (dataset == "protein") {
+            return convert<std::pair<int, std::string>, std::tuple<int, int, int>>(source, files, GXLGraphReader::read_Proteins,
+                                                                                   GXLGraphReader::parse_Proteins, output);
+        }
+        throw std::runtime_error("unknown --dataset " + dataset + ", use aids, muta or protein");
+    }
+    catch (std::exception &e) {
+        std::cout << "exception " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,447 @@
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "auxiliary/zip_archive.hpp"
+#include "engine/search_cli.hpp"
+#include "engine/similarity_search.hpp"
+
+/*
+ * Answers similarity queries over a Unix domain socket with one SimilaritySearch engine, so the dataset, the collection,
+ * GEDLIB and the bound cache are loaded once for all requests. The protocol is line based, a client sends
+ *
+ *   query <file or id> <tau> [<k>]    searches a graph of the collection, by file name or by the numeric id of its file
+ *   gxl <tau> <bytes> [<k>]           followed by <bytes> bytes of GXL (at most 16 MiB), searches a graph that is not part
+ *                                     of the collection
+ *   cancel                            stops the running request
+ *   quit                              closes the connection
+ *
+ * where tau is a threshold of at least 0, and the server answers a range search with one "accepted <id> <file>" line per database graph as soon as it is
+ * accepted. With k > 0 it searches the k nearest graphs within tau instead and answers with one
+ * "nearest <id> <file> <distance> <exact|upper>" line per graph, nearest first, once the search is over. Both end with
+ * "done <accepted> <candidates> <seconds>", "cancelled <accepted>" or "error <message>".
+ * Connections beyond --clients get "busy" and are closed. Requests of all connections share the engine one at a time.
+ */
+
+namespace {
+    using namespace std::chrono_literals;
+
+    std::atomic<bool> stop_requested{false};
+
+    void request_stop(int) {
+        stop_requested = true;
+    }
+
+    /// poll timeout of every blocking wait, bounds how late a stop or a cancel is noticed
+    constexpr auto poll_interval = 200ms;
+
+    /// largest GXL payload of a request, the graphs of the datasets have a few KB
+    constexpr std::size_t max_gxl_bytes = 16 << 20;
+
+    /// line and byte reader of a client socket that gives up once the server stops
+    class connection {
+    public:
+        explicit connection(int fd) : fd_(fd) {}
+
+        ~connection() { ::close(fd_); }
+
+        connection(const connection &) = delete;
+
+        connection &operator=(const connection &) = delete;
+
+        /// @return false on end of stream or shutdown
+        bool read_line(std::string &line) {
+            std::size_t end;
+            while ((end = buffer_.find('\n')) == std::string::npos) {
+                if (!fill()) {
+                    return false;
+                }
+            }
+            line = buffer_.substr(0, end);
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            buffer_.erase(0, end + 1);
+            return true;
+        }
+
+        bool read_bytes(std::string &bytes, std::size_t count) {
+            while (buffer_.size() < count) {
+                if (!fill()) {
+                    return false;
+                }
+            }
+            bytes = buffer_.substr(0, count);
+            buffer_.erase(0, count);
+            return true;
+        }
+
+        /// @brief drops the next count bytes without keeping more than one read of them
+        bool skip_bytes(std::size_t count) {
+            while (buffer_.size() < count) {
+                count -= buffer_.size();
+                buffer_.clear();
+                if (!fill()) {
+                    return false;
+                }
+            }
+            buffer_.erase(0, count);
+            return true;
+        }
+
+        bool send(const std::string &line) {
+            const std::string message = line + "\n";
+            std::size_t sent = 0;
+            while (sent < message.size()) {
+                const ssize_t n = ::send(fd_, message.data() + sent, message.size() - sent, MSG_NOSIGNAL);
+                if (n <= 0) {
+                    return false;
+                }
+                sent += n;
+            }
+            return true;
+        }
+
+        /**
+         * reads what the client sent without blocking, a "cancel" line or a closed connection cancel the running
+         * request. Other lines stay buffered for the next read_line().
+         */
+        bool cancel_requested() {
+            while (!closed_ && receive(0) > 0) {}
+            if (closed_ || stop_requested) {
+                return true;
+            }
+            std::size_t begin = 0, end;
+            while ((end = buffer_.find('\n', begin)) != std::string::npos) {
+                std::string line = buffer_.substr(begin, end - begin);
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                if (line == "cancel") {
+                    buffer_.erase(begin, end + 1 - begin);
+                    return true;
+                }
+                begin = end + 1;
+            }
+            return false;
+        }
+
+    private:
+        /// @return 1 if data was read, 0 on timeout, -1 once the connection is closed
+        int receive(int timeout_ms) {
+            pollfd p{fd_, POLLIN, 0};
+            const int ready = ::poll(&p, 1, timeout_ms);
+            if (ready <= 0) {
+                return ready < 0 && errno != EINTR ? (closed_ = true, -1) : 0;
+            }
+            char chunk[4096];
+            const ssize_t n = ::recv(fd_, chunk, sizeof(chunk), 0);
+            if (n <= 0) {
+                closed_ = true;
+                return -1;
+            }
+            buffer_.append(chunk, n);
+            return 1;
+        }
+
+        bool fill() {
+            while (!closed_ && !stop_requested) {
+                if (receive(static_cast<int>(poll_interval.count())) > 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        int fd_;
+        std::string buffer_;
+        bool closed_ = false;
+    };
+
+    template<typename Traits>
+    class server {
+    public:
+        server(SimilaritySearch<Traits> &engine, options &opt) : engine_(engine), opt_(opt) {
+            const auto &db = engine.database();
+            for (std::size_t i = 0; i < db.size(); i++) {
+                files_by_id_.emplace(db.id(i), db.file(i));
+            }
+        }
+
+        void serve(int fd) {
+            connection client(fd);
+            for (std::string line; client.read_line(line);) {
+                std::istringstream request(line);
+                std::string command;
+                request >> command;
+                if (command.empty() || command == "cancel") {
+                    // a cancel that arrives after its request finished has nothing left to stop
+                    continue;
+                }
+                if (command == "quit") {
+                    break;
+                }
+                std::string response;
+                try {
+                    response = answer(client, command, request);
+                }
+                catch (std::exception &e) {
+                    response = std::string("error ") + e.what();
+                }
+                if (!client.send(response)) {
+                    break;
+                }
+            }
+        }
+
+    private:
+        std::string answer(connection &client, const std::string &command, std::istringstream &request) {
+            double threshold;
+            if (command == "query") {
+                std::string graph;
+                if (!(request >> graph >> threshold)) {
+                    return "error usage: query <file or id> <tau> [<k>]";
+                }
+                if (!(threshold >= 0)) {
+                    return "error tau has to be at least 0";
+                }
+                std::size_t k;
+                if (!nearest_count(request, k)) {
+                    return "error k has to be a positive number";
+                }
+                if (graph.find_first_not_of("0123456789") == std::string::npos) {
+                    auto it = files_by_id_.find(static_cast<std::uint32_t>(std::stoul(graph)));
+                    if (it == files_by_id_.end()) {
+                        return "error no database graph has the id " + graph;
+                    }
+                    graph = it->second;
+                }
+                return run(client, [&](const query_control &control) {
+                    if (k == 0) {
+                        return engine_.query(graph, threshold, control);
+                    }
+                    std::vector<nearest_graph> nearest;
+                    const bool finished = engine_.top_k(graph, k, threshold, nearest, control);
+                    send_nearest(client, nearest);
+                    return finished;
+                });
+            }
+            if (command == "gxl") {
+                std::string count;
+                std::size_t bytes;
+                if (!(request >> threshold >> count) || !positive_number(count, bytes)) {
+                    return "error usage: gxl <tau> <bytes> [<k>]";
+                }
+                if (bytes > max_gxl_bytes) {
+                    // the payload is skipped so that the next line is a request again
+                    client.skip_bytes(bytes);
+                    return "error GXL payload of " + count + " bytes, at most " + std::to_string(max_gxl_bytes) + " are accepted";
+                }
+                if (!(threshold >= 0)) {
+                    client.skip_bytes(bytes);
+                    return "error tau has to be at least 0";
+                }
+                std::size_t k;
+                if (!nearest_count(request, k)) {
+                    client.skip_bytes(bytes);
+                    return "error k has to be a positive number";
+                }
+                std::string payload;
+                if (!client.read_bytes(payload, bytes)) {
+                    return "error incomplete GXL payload";
+                }
+                memory_streambuf buffer(payload.data(), payload.size());
+                std::istream in(&buffer);
+                auto query_graph = Traits::parse(in);
+                return run(client, [&](const query_control &control) {
+                    if (k == 0) {
+                        return engine_.query(std::move(query_graph), "request", threshold, control);
+                    }
+                    std::vector<nearest_graph> nearest;
+                    const bool finished = engine_.top_k(std::move(query_graph), "request", k, threshold, nearest, control);
+                    send_nearest(client, nearest);
+                    return finished;
+                });
+            }
+            return "error unknown command " + command;
+        }
+
+        /// @return false if token is not a number > 0, e.g. "-1", which an unsigned extraction would wrap around
+        static bool positive_number(const std::string &token, std::size_t &value) {
+            if (token.empty() || token.size() > 18 || token.find_first_not_of("0123456789") != std::string::npos) {
+                return false;
+            }
+            value = std::stoull(token);
+            return value > 0;
+        }
+
+        /// @brief the optional k of a request, 0 for a range search
+        /// @return false if k is given but not a number > 0
+        static bool nearest_count(std::istringstream &request, std::size_t &k) {
+            k = 0;
+            std::string token;
+            return !(request >> token) || positive_number(token, k);
+        }
+
+        void send_nearest(connection &client, const std::vector<nearest_graph> &nearest) {
+            const auto &db = engine_.database();
+            for (const auto &n: nearest) {
+                client.send("nearest " + std::to_string(db.id(db.index(n.file))) + " " + n.file + " " + std::to_string(n.distance) +
+                            (n.exact ? " exact" : " upper"));
+            }
+        }
+
+        template<typename Search>
+        std::string run(connection &client, const Search &search) {
+            std::unique_lock<std::timed_mutex> lock(engine_mutex_, std::defer_lock);
+            while (!lock.try_lock_for(poll_interval)) {
+                if (client.cancel_requested()) {
+                    return "cancelled 0";
+                }
+            }
+            const auto start = std::chrono::steady_clock::now();
+            query_control control;
+            control.cancelled = [&] { return client.cancel_requested(); };
+            control.accepted = [&](const std::string &file) {
+                const auto &db = engine_.database();
+                client.send("accepted " + std::to_string(db.id(db.index(file))) + " " + file);
+            };
+            const bool finished = search(control);
+            const std::size_t accepted = opt_.accepted_graphs.size();
+            if (!finished) {
+                return "cancelled " + std::to_string(accepted);
+            }
+            const std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+            return "done " + std::to_string(accepted) + " " + std::to_string(opt_.graphlist.size()) + " " + std::to_string(seconds.count());
+        }
+
+        SimilaritySearch<Traits> &engine_;
+        options &opt_;
+        std::unordered_map<std::uint32_t, std::string> files_by_id_;
+        /// the engine is not thread-safe, a timed lock lets waiting requests still notice a cancel
+        std::timed_mutex engine_mutex_;
+    };
+
+    int listen_on(const std::string &path) {
+        sockaddr_un address{};
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("socket path has to have 1 to " + std::to_string(sizeof(address.sun_path) - 1) + " characters");
+        }
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            throw std::runtime_error(std::string("can not create a socket: ") + std::strerror(errno));
+        }
+        ::unlink(path.c_str());
+        if (::bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || ::listen(fd, 16) < 0) {
+            const std::string reason = std::strerror(errno);
+            ::close(fd);
+            throw std::runtime_error("can not listen on " + path + ": " + reason);
+        }
+        return fd;
+    }
+
+    template<typename Traits>
+    int serve(int argc, char **argv) {
+        try {
+            cxxopts::Options opts("similarity_server", "answer graph similarity queries over a Unix domain socket");
+            add_search_options(opts, Traits::archive);
+            opts.add_options()
+                    ("dataset", "aids, muta or protein", cxxopts::value<std::string>()->default_value("aids"))(
+                    "socket", "path of the Unix domain socket", cxxopts::value<std::string>()->default_value("/tmp/similarity_server.sock"))(
+                    "clients", "number of connections served at once, further connections are answered with busy", cxxopts::value<int>()->default_value("4"));
+            auto arguments = opts.parse(argc, argv);
+            const std::string socket_path = arguments["socket"].as<std::string>();
+            const int clients = std::max(1, arguments["clients"].as<int>());
+            options opt = parse_search_options(arguments);
+
+            SimilaritySearch<Traits> engine(opt, arguments["archive"].as<std::string>());
+            server<Traits> handler(engine, opt);
+
+            std::signal(SIGPIPE, SIG_IGN);
+            std::signal(SIGINT, request_stop);
+            std::signal(SIGTERM, request_stop);
+            const int listener = listen_on(socket_path);
+            std::cout << "serving " << Traits::name << " (" << engine.database().size() << " graphs) on " << socket_path << std::endl;
+
+            std::mutex active_mutex;
+            std::condition_variable active_changed;
+            int active = 0;
+            while (!stop_requested) {
+                pollfd p{listener, POLLIN, 0};
+                if (::poll(&p, 1, static_cast<int>(poll_interval.count())) <= 0) {
+                    continue;
+                }
+                const int fd = ::accept(listener, nullptr, nullptr);
+                if (fd < 0) {
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(active_mutex);
+                if (active >= clients) {
+                    lock.unlock();
+                    connection(fd).send("busy");
+                    continue;
+                }
+                active++;
+                std::thread([&, fd] {
+                    handler.serve(fd);
+                    std::lock_guard<std::mutex> done(active_mutex);
+                    active--;
+                    active_changed.notify_all();
+                }).detach();
+            }
+
+            // the connections notice the stop within one poll interval, a running request at its next pair
+            std::unique_lock<std::mutex> lock(active_mutex);
+            active_changed.wait(lock, [&] { return active == 0; });
+            ::close(listener);
+            ::unlink(socket_path.c_str());
+        }
+        catch (std::exception &e) {
+            std::cout << "exception " << e.what() << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    std::string dataset;
+    try {
+        // the dataset selects the traits and with them the defaults of the other options
+        cxxopts::Options pre("similarity_server", "");
+        pre.allow_unrecognised_options().add_options()("dataset", "", cxxopts::value<std::string>()->default_value("aids"));
+        dataset = pre.parse(argc, argv)["dataset"].as<std::string>();
+    }
+    catch (std::exception &e) {
+        std::cout << "exception " << e.what() << std::endl;
+        return 1;
+    }
+    if (dataset == "aids") {
+        return serve<aids_traits>(argc, argv);
+    }
+    if (dataset == "muta") {
+        return serve<muta_traits>(argc, argv);
+    }
+    if (dataset == "protein") {
+        return serve<protein_traits>(argc, argv);
+    }
+    std::cout << "unknown --dataset " << dataset << ", use aids, muta or protein" << std::endl;
+    return 1;
+}
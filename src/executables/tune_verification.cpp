@@ -0,0 +1,202 @@
+#define GXL_GEDLIB_SHARED
+
+#include "src/env/ged_env.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <random>
+
+#include "auxiliary/cxxopts.hpp"
+#include "auxiliary/dataset_registry.hpp"
+#include "auxiliary/gedlib_costs.hpp"
+#include "auxiliary/graph_database.hpp"
+#include "auxiliary/options.hpp"
+#include "auxiliary/solver_profile.hpp"
+#include "engine/dataset_traits.hpp"
+#include "gurobi/FORI_VERIFICATION.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * offline tuning of the solver parameters of the verification ILP. Random pairs of a dataset are sampled into size
+ * buckets (number of model variables), and for every bucket the parameters are tuned one after the other (coordinate
+ * descent): LP method, presolve, cuts, heuristics and threads. A value is kept if it lowers the total verification time
+ * of the bucket's pairs by at least 2%, time outs count with the full time limit. Every time is the median of several
+ * runs of the bucket. The result is a solver_profile that the prepro_verification executables load with --solverProfile.
+ */
+
+/// tunes on the graphs the search runs on: the collection of Traits, from its archive or its reader folder
+template<typename Traits>
+int tune(options &opt, bool uniformCosts, const std::vector<int> &bucketBounds, int pairs, int repeats, const std::string &profilePath) {
+    using T = typename Traits::node_label;
+    using U = typename Traits::edge_label;
+    const std::string archive = Traits::archive;
+    const std::vector<std::string> files = dataset_registry::collection_files(Traits::collection);
+    GraphDatabase<T, U> db = !archive.empty() && fs::exists(archive) ? GraphDatabase<T, U>::from_zip(archive, Traits::parse, files)
+                                                                     : GraphDatabase<T, U>(Traits::reader_folder, files, Traits::read);
+    if (db.size() < 2) {
+        throw std::runtime_error(std::string("tune_verification: less than two graphs in ") + Traits::collection);
+    }
+
+    FORI_VERIFICATION<T, U> ilp(opt);
+
+    // sample pairs into the buckets, every bucket gets up to pairs of them
+    std::vector<std::vector<std::pair<int, int>>> samples(bucketBounds.size());
+    std::mt19937 gen(opt.seed_);
+    std::uniform_int_distribution<int> pick(0, static_cast<int>(db.size()) - 1);
+    const long attempts = 200L * pairs * static_cast<long>(bucketBounds.size());
+    for (long a = 0; a < attempts; a++) {
+        int g = pick(gen);
+        int h = pick(gen);
+        if (g == h) {
+            continue;
+        }
+        int vars = ilp.model_size(db.get(g), db.get(h));
+        auto b = std::distance(bucketBounds.begin(), std::lower_bound(bucketBounds.begin(), bucketBounds.end(), vars));
+        if (b == static_cast<long>(bucketBounds.size()) or samples[b].size() >= static_cast<std::size_t>(pairs)) {
+            continue;
+        }
+        samples[b].emplace_back(g, h);
+    }
+
+    // verification time of the sampled pairs of one bucket with the profile set on ilp
+    auto run = [&](const std::vector<std::pair<int, int>> &sample) {
+        double total = 0.0;
+        for (auto [g, h]: sample) {
+            getGEDLIBcosts<T, U> costs(&db.get(g), &db.get(h));
+            costs.getEditCosts(uniformCosts);
+            db.get(h).releaseGEDLIBeditcosts();
+            opt.G_id_ = db.file(g);
+            opt.H_id_ = db.file(h);
+            auto start = std::chrono::high_resolution_clock::now();
+            try {
+                ilp.ged(db.get(g), db.get(h));
+            } catch (std::runtime_error &e) {
+                std::cout << db.file(g) << " " << db.file(h) << ": " << e.what() << std::endl;
+                total += opt.timelimit_;
+                continue;
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+            total += opt.status_ == static_cast<int>(solver::Status::TIME_LIMIT) ? opt.timelimit_ : seconds;
+        }
+        return total;
+    };
+
+    // total verification time of the sampled pairs of one bucket with setting s, the median of repeats runs as a single
+    // run is too noisy to tell a 2% difference apart
+    auto evaluate = [&](const std::vector<std::pair<int, int>> &sample, const solver_profile::setting &s) {
+        solver_profile single;
+        single.buckets.push_back({std::numeric_limits<int>::max(), s, 0, 0.0});
+        ilp.set_profile(single);
+        std::vector<double> totals;
+        for (int r = 0; r < repeats; r++) {
+            totals.push_back(run(sample));
+        }
+        std::nth_element(totals.begin(), totals.begin() + totals.size() / 2, totals.end());
+        return totals[totals.size() / 2];
+    };
+
+    solver_profile profile;
+    profile.context = opt.dataset_name_ + (uniformCosts ? "/uniform" : "/non-uniform");
+    for (std::size_t b = 0; b < bucketBounds.size(); b++) {
+        if (samples[b].empty()) {
+            std::cout << "bucket <= " << bucketBounds[b] << ": no pairs sampled, skipped" << std::endl;
+            continue;
+        }
+        solver_profile::setting best;
+        double best_time = evaluate(samples[b], best);
+        std::cout << "bucket <= " << bucketBounds[b] << " (" << samples[b].size() << " pairs) " << best.str() << ": " << best_time << "s" << std::endl;
+
+        auto sweep = [&](const auto &values, auto set) {
+            auto current = best;
+            for (const auto &value: values) {
+                auto candidate = current;
+                set(candidate, value);
+                double time = evaluate(samples[b], candidate);
+                std::cout << "    " << candidate.str() << ": " << time << "s" << std::endl;
+                if (time < 0.98 * best_time) {
+                    best = candidate;
+                    best_time = time;
+                }
+            }
+        };
+        sweep(std::vector<solver::LpMethod>{solver::LpMethod::AUTOMATIC, solver::LpMethod::DUAL_SIMPLEX, solver::LpMethod::PRIMAL_SIMPLEX},
+              [](solver_profile::setting &s, solver::LpMethod v) { s.method = v; });
+        sweep(std::vector<int>{0, 1, 2}, [](solver_profile::setting &s, int v) { s.presolve = v; });
+        sweep(std::vector<int>{0, 1, 2}, [](solver_profile::setting &s, int v) { s.cuts = v; });
+        sweep(std::vector<double>{0.0, 0.2, 0.5}, [](solver_profile::setting &s, double v) { s.heuristics = v; });
+        std::vector<int> threads;
+        for (int t = 1; t < opt.threads_; t *= 2) {
+            threads.push_back(t);
+        }
+        sweep(threads, [](solver_profile::setting &s, int v) { s.threads = v; });
+
+        std::cout << "bucket <= " << bucketBounds[b] << ": " << best.str() << ": " << best_time << "s" << std::endl;
+        profile.buckets.push_back({bucketBounds[b], best, static_cast<int>(samples[b].size()), best_time / samples[b].size()});
+    }
+    profile.save(profilePath);
+    std::cout << "profile written to " << profilePath << std::endl;
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+        cxxopts::Options opts("tune_verification", "tune the solver parameters of the verification ILP per model size and write a solver profile");
+        opts.add_options()
+            ("d, dataset", "aids, muta or protein", cxxopts::value<std::string>())(
+            "f, formulation", "FORI or FORI-COMPACT", cxxopts::value<std::string>()->default_value("FORI"))(
+            "o, output", "profile file to write", cxxopts::value<std::string>())(
+            "t, threads", "number of threads, the tuning tries powers of two below it", cxxopts::value<int>()->default_value("1"))(
+            "l, timelimit", "number of seconds a single verification is allowed to run for", cxxopts::value<double>()->default_value("60"))(
+            "r, seed", "random seed of the pair sampling and the solver", cxxopts::value<int>()->default_value("1"))(
+            "v, verificationThreshold", "threshold the sampled pairs are verified against", cxxopts::value<double>()->default_value("10"))(
+            "u, uniformCosts", "Set to 1 if uniform edit costs should be used, 0 otherwise", cxxopts::value<bool>()->default_value("false"))(
+            "b, backend", "MIP solver for the verification ILP (gurobi or highs)", cxxopts::value<std::string>()->default_value("gurobi"))(
+            "pairs", "sampled pairs per size bucket", cxxopts::value<int>()->default_value("20"))(
+            "repeats", "runs of a bucket per setting, the median time counts", cxxopts::value<int>()->default_value("3"))(
+            "buckets", "upper bounds of the size buckets in model variables", cxxopts::value<std::vector<int>>()->default_value("500,2000,10000,50000,1000000"));
+
+        auto arguments = opts.parse(argc, argv);
+        const std::string dataset = arguments["dataset"].as<std::string>();
+        const std::string output = arguments["output"].as<std::string>();
+        const bool uniformCosts = arguments["uniformCosts"].as<bool>();
+        const int pairs = arguments["pairs"].as<int>();
+        const int repeats = arguments["repeats"].as<int>();
+        if (repeats < 1) {
+            throw std::runtime_error("--repeats must be at least 1");
+        }
+        std::vector<int> buckets = arguments["buckets"].as<std::vector<int>>();
+        std::sort(buckets.begin(), buckets.end());
+
+        options opt;
+        opt.dataset_name_ = dataset;
+        opt.formulation_name_ = arguments["formulation"].as<std::string>();
+        opt.threads_ = arguments["threads"].as<int>();
+        opt.timelimit_ = arguments["timelimit"].as<double>();
+        opt.seed_ = arguments["seed"].as<int>();
+        opt.threshold = arguments["verificationThreshold"].as<double>();
+        if (!(opt.threshold >= 0)) {
+            throw std::runtime_error("--verificationThreshold has to be at least 0");
+        }
+        opt.solver_backend_ = arguments["backend"].as<std::string>();
+        // only the ILP is tuned, nothing may decide a pair before it or shrink its model
+        opt.lagrangian_ = false;
+        opt.reduced_cost_fixing_ = false;
+        opt.flat = true;
+
+        if (dataset == "aids") {
+            return tune<aids_traits>(opt, uniformCosts, buckets, pairs, repeats, output);
+        }
+        if (dataset == "muta") {
+            return tune<muta_traits>(opt, uniformCosts, buckets, pairs, repeats, output);
+        }
+        if (dataset == "protein") {
+            return tune<protein_traits>(opt, uniformCosts, buckets, pairs, repeats, output);
+        }
+        throw std::runtime_error("unknown --dataset " + dataset + ", use aids, muta or protein");
+    }
+    catch (std::exception &e) {
+        std::cout << "exception " << e.what() << std::endl;
+        return 1;
+    }
+}
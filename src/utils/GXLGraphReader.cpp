@@ -15,11 +15,14 @@
  * @return
  */
 graph<std::string, int> GXLGraphReader::read_mutagenicity(const std::string &path) {
-
         std::ifstream graphFile(path);
         if (!graphFile.is_open()) {
                 throw std::runtime_error("could not open file " + path);
         }
+        return parse_mutagenicity(graphFile);
+}
+
+graph<std::string, int> GXLGraphReader::parse_mutagenicity(std::istream &graphFile) {
         std::string line;
 
         auto syntaxCheck = [](const std::vector<std::string> &tokens) {
@@ -151,7 +154,7 @@ graph<std::string, int> GXLGraphReader::read_mutagenicity(const std::string &pat
                 G.add_edge(node1, node2, attrValue);
         };
 
-        auto parseHead = [](std::ifstream &graphFile, std::string &line, graph<std::string, int> &G) {
+        auto parseHead = [](std::istream &graphFile, std::string &line, graph<std::string, int> &G) {
                 std::string graphID;
 
                 std::getline(graphFile, line);
@@ -197,7 +200,6 @@ graph<std::string, int> GXLGraphReader::read_mutagenicity(const std::string &pat
         };
         graph<std::string, int> G = parseFile();
         G.set_dataset("mutagenicity");
-        graphFile.close();
 
         return G;
 }
@@ -426,11 +428,14 @@ graph<std::pair<double, double>, float> GXLGraphReader::read_CMU(const std::stri
 }
 
 graph<std::pair<int, std::string>, std::tuple<int, int, int>> GXLGraphReader::read_Proteins(const std::string &path) {
-
         std::ifstream graphFile(path);
         if (!graphFile.is_open()) {
                 throw std::runtime_error("In read_Proteins: could not open file " + path);
         }
+        return parse_Proteins(graphFile);
+}
+
+graph<std::pair<int, std::string>, std::tuple<int, int, int>> GXLGraphReader::parse_Proteins(std::istream &graphFile) {
         std::string line;
 
         auto syntaxCheck = [](const std::vector<std::string> &tokens) {
@@ -621,7 +626,7 @@ graph<std::pair<int, std::string>, std::tuple<int, int, int>> GXLGraphReader::re
                 G.add_edge(node1, node2, attrValue);
         };
 
-        auto parseHead = [](std::ifstream &graphFile, std::string &line, graph<std::pair<int, std::string>, std::tuple<int, int, int>> &G) {
+        auto parseHead = [](std::istream &graphFile, std::string &line, graph<std::pair<int, std::string>, std::tuple<int, int, int>> &G) {
                 std::string graphID;
 
                 std::getline(graphFile, line);
@@ -668,7 +673,6 @@ graph<std::pair<int, std::string>, std::tuple<int, int, int>> GXLGraphReader::re
 
         graph<std::pair<int, std::string>, std::tuple<int, int, int>> G = parseFile();
         G.set_dataset("protein");
-        graphFile.close();
 
         return G;
 }
@@ -676,11 +680,14 @@ graph<std::pair<int, std::string>, std::tuple<int, int, int>> GXLGraphReader::re
 
 
 graph<std::string, int> GXLGraphReader::read_AIDS(const std::string &path) {
-
-       std::ifstream graphFile(path);
+        std::ifstream graphFile(path);
         if (!graphFile.is_open()) {
                 throw std::runtime_error("could not open file " + path);
         }
+        return parse_AIDS(graphFile);
+}
+
+graph<std::string, int> GXLGraphReader::parse_AIDS(std::istream &graphFile) {
         std::string line;
 
         auto syntaxCheck = [](const std::vector<std::string> &tokens) {
@@ -824,7 +831,7 @@ graph<std::string, int> GXLGraphReader::read_AIDS(const std::string &path) {
                 G.add_edge(node1, node2, attrValue);
         };
 
-        auto parseHead = [](std::ifstream &graphFile, std::string &line, graph<std::string, int> &G) {
+        auto parseHead = [](std::istream &graphFile, std::string &line, graph<std::string, int> &G) {
                 std::string graphID;
 
                 std::getline(graphFile, line);
@@ -870,7 +877,6 @@ graph<std::string, int> GXLGraphReader::read_AIDS(const std::string &path) {
         };
         graph<std::string, int> G = parseFile();
         G.set_dataset("aids");
-        graphFile.close();
 
         return G;
 }
@@ -0,0 +1,33 @@
+#include <cstdlib>
+#include <new>
+
+#include "auxiliary/memory.hpp"
+
+// replaces the global operator new of the executable that links this file, so that memory::allocations() counts its
+// allocations. It is not part of the similarity_search library, programs that link the library keep their allocator.
+
+void *operator new(std::size_t size) {
+        memory::allocation_counter.fetch_add(1, std::memory_order_relaxed);
+        if (size == 0) {
+                size = 1;
+        }
+        while (true) {
+                void *p = std::malloc(size);
+                if (p != nullptr) {
+                        return p;
+                }
+                std::new_handler handler = std::get_new_handler();
+                if (handler == nullptr) {
+                        throw std::bad_alloc();
+                }
+                handler();
+        }
+}
+
+void operator delete(void *p) noexcept {
+        std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+        std::free(p);
+}
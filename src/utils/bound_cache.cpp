@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "auxiliary/bound_cache.hpp"
+
+namespace {
+        /// FNV-1a, never 0 so that zero padding can not match a context
+        std::uint32_t hash_context(const std::string &context) {
+                std::uint32_t h = 2166136261u;
+                for (unsigned char c: context) {
+                        h = (h ^ c) * 16777619u;
+                }
+                return h | 1u;
+        }
+
+        /// flock that is released on every exit path
+        struct file_lock {
+                int fd;
+
+                file_lock(int fd, int operation) : fd(fd) {
+                        while (flock(fd, operation) != 0) {
+                                if (errno != EINTR) {
+                                        throw std::runtime_error(std::string("bound_cache: flock failed: ") + std::strerror(errno));
+                                }
+                        }
+                }
+
+                ~file_lock() { flock(fd, LOCK_UN); }
+        };
+}
+
+bound_cache::bound_cache(const std::string &path, const std::string &context) : context_(hash_context(context)) {
+        fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+        if (fd_ < 0) {
+                throw std::runtime_error("bound_cache: could not open " + path + ": " + std::strerror(errno));
+        }
+        refresh();
+}
+
+bound_cache::~bound_cache() {
+        if (fd_ >= 0) {
+                close(fd_);
+        }
+}
+
+bool bound_cache::merge(const record &rec) {
+        if (rec.magic != magic_ or rec.context != context_) {
+                return false;
+        }
+        auto &e = entries_[key(rec.query, rec.candidate)];
+        bool tighter = rec.lower > e.lower or rec.upper < e.upper;
+        e.lower = std::max(e.lower, rec.lower);
+        e.upper = std::min(e.upper, rec.upper);
+        return tighter;
+}
+
+void bound_cache::refresh() {
+        file_lock lock(fd_, LOCK_SH);
+        struct stat st{};
+        if (fstat(fd_, &st) != 0) {
+                throw std::runtime_error(std::string("bound_cache: fstat failed: ") + std::strerror(errno));
+        }
+        // only whole records, a torn tail is padded by the next writer
+        off_t end = st.st_size - st.st_size % static_cast<off_t>(sizeof(record));
+        if (end <= offset_) {
+                return;
+        }
+        std::vector<record> records(static_cast<std::size_t>(end - offset_) / sizeof(record));
+        auto bytes = static_cast<std::size_t>(end - offset_);
+        std::size_t done = 0;
+        while (done < bytes) {
+                ssize_t n = pread(fd_, reinterpret_cast<char *>(records.data()) + done, bytes - done, offset_ + static_cast<off_t>(done));
+                if (n < 0 and errno == EINTR) {
+                        continue;
+                }
+                if (n <= 0) {
+                        throw std::runtime_error(std::string("bound_cache: read failed: ") + std::strerror(errno));
+                }
+                done += static_cast<std::size_t>(n);
+        }
+        for (const auto &rec: records) {
+                merge(rec);
+        }
+        offset_ = end;
+}
+
+bound_cache::entry bound_cache::find(std::uint32_t query, std::uint32_t candidate) {
+        refresh();
+        auto it = entries_.find(key(query, candidate));
+        return it == entries_.end() ? entry{} : it->second;
+}
+
+void bound_cache::add(std::uint32_t query, std::uint32_t candidate, double lower, double upper) {
+        record rec{context_, query, lower, upper, candidate, magic_};
+        if (not merge(rec)) {
+                return;
+        }
+        file_lock lock(fd_, LOCK_EX);
+        struct stat st{};
+        if (fstat(fd_, &st) != 0) {
+                throw std::runtime_error(std::string("bound_cache: fstat failed: ") + std::strerror(errno));
+        }
+        // a process that died in the middle of a write left a partial record, pad it so that records stay aligned
+        std::size_t torn = static_cast<std::size_t>(st.st_size) % sizeof(record);
+        std::vector<char> buffer(torn == 0 ? 0 : sizeof(record) - torn, 0);
+        buffer.insert(buffer.end(), reinterpret_cast<const char *>(&rec), reinterpret_cast<const char *>(&rec) + sizeof(record));
+        std::size_t done = 0;
+        while (done < buffer.size()) {
+                ssize_t n = write(fd_, buffer.data() + done, buffer.size() - done);
+                if (n < 0 and errno == EINTR) {
+                        continue;
+                }
+                if (n < 0) {
+                        throw std::runtime_error(std::string("bound_cache: write failed: ") + std::strerror(errno));
+                }
+                done += static_cast<std::size_t>(n);
+        }
+}
@@ -0,0 +1,68 @@
+#include <fstream>
+#include <stdexcept>
+
+#include "auxiliary/dataset_registry.hpp"
+
+dataset_registry::dataset_registry(const std::string &collection) : collection_(collection), files_(collection_files(collection)) {
+        ids_.reserve(files_.size());
+        positions_.reserve(files_.size());
+        id_positions_.reserve(files_.size());
+        for (std::size_t p = 0; p < files_.size(); p++) {
+                ids_.push_back(file_id(files_[p]));
+                if (!positions_.emplace(files_[p], p).second) {
+                        throw std::runtime_error(collection + " lists " + files_[p] + " twice");
+                }
+                if (!id_positions_.emplace(ids_[p], p).second) {
+                        throw std::runtime_error(collection + " lists the id " + std::to_string(ids_[p]) + " twice");
+                }
+        }
+}
+
+std::vector<std::string> dataset_registry::collection_files(const std::string &collection) {
+        std::ifstream in(collection);
+        if (!in) {
+                throw std::runtime_error("can not read the collection " + collection);
+        }
+        // <graph file="100.gxl" class="a"/>, one per line
+        const std::string key = "file=\"";
+        std::vector<std::string> files;
+        for (std::string line; std::getline(in, line);) {
+                const auto graph = line.find("<graph");
+                if (graph == std::string::npos) {
+                        continue;
+                }
+                const auto begin = line.find(key, graph);
+                const auto end = begin == std::string::npos ? begin : line.find('"', begin + key.size());
+                if (end != std::string::npos) {
+                        files.push_back(line.substr(begin + key.size(), end - begin - key.size()));
+                }
+        }
+        if (files.empty()) {
+                throw std::runtime_error("no graphs listed in " + collection);
+        }
+        return files;
+}
+
+std::size_t dataset_registry::position(const std::string &file) const {
+        auto it = positions_.find(file);
+        if (it == positions_.end()) {
+                throw std::runtime_error(collection_ + " does not list " + file);
+        }
+        return it->second;
+}
+
+std::size_t dataset_registry::position_of_id(std::uint32_t id) const {
+        auto it = id_positions_.find(id);
+        if (it == id_positions_.end()) {
+                throw std::runtime_error(collection_ + " does not list a graph with id " + std::to_string(id));
+        }
+        return it->second;
+}
+
+void dataset_registry::set_gedlib_ids(std::vector<std::size_t> ids) {
+        if (ids.size() != files_.size()) {
+                throw std::runtime_error("GEDLIB loaded " + std::to_string(ids.size()) + " graphs, " + collection_ + " lists " +
+                                         std::to_string(files_.size()));
+        }
+        gedlib_ids_ = std::move(ids);
+}
@@ -0,0 +1,64 @@
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "auxiliary/graph_snapshot.hpp"
+
+graph_snapshot::graph_snapshot(const std::string &path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+                throw std::runtime_error("graph_snapshot: could not open " + path + ": " + std::strerror(errno));
+        }
+        struct stat st{};
+        if (fstat(fd, &st) != 0) {
+                close(fd);
+                throw std::runtime_error("graph_snapshot: could not stat " + path + ": " + std::strerror(errno));
+        }
+        length_ = static_cast<std::size_t>(st.st_size);
+        if (length_ < sizeof(snapshot::header)) {
+                close(fd);
+                throw std::runtime_error("graph_snapshot: " + path + " is too short to be a snapshot");
+        }
+        void *data = mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+        // the mapping keeps its own reference to the file
+        close(fd);
+        if (data == MAP_FAILED) {
+                throw std::runtime_error("graph_snapshot: could not map " + path + ": " + std::strerror(errno));
+        }
+        data_ = static_cast<const char *>(data);
+
+        const auto &h = head();
+        std::string problem;
+        if (std::memcmp(h.magic, snapshot::magic, sizeof(snapshot::magic)) != 0) {
+                problem = "is not a snapshot";
+        } else if (h.byte_order != snapshot::byte_order) {
+                problem = "was written on a machine with a different byte order";
+        } else if (h.version != snapshot::version) {
+                problem = "has version " + std::to_string(h.version) + ", expected " + std::to_string(snapshot::version);
+        } else if (h.file_size != length_ || h.blob_offset > length_ ||
+                   h.entries_offset + h.graphs * sizeof(snapshot::entry) > h.nodes_offset ||
+                   h.nodes_offset + 3 * h.nodes * sizeof(std::uint32_t) > h.edges_offset ||
+                   h.edges_offset + 3 * h.edges * sizeof(std::uint32_t) > h.csr_offset ||
+                   h.csr_offset + (h.nodes + h.graphs) * sizeof(std::uint32_t) > h.adjacency_offset ||
+                   h.adjacency_offset + 2 * h.edges * sizeof(std::uint32_t) > h.dictionary_offset ||
+                   h.dictionary_offset + (h.node_labels + h.edge_labels + 2) * sizeof(std::uint64_t) > h.blob_offset) {
+                problem = "is truncated or corrupt";
+        }
+        if (!problem.empty()) {
+                munmap(const_cast<char *>(data_), length_);
+                throw std::runtime_error("graph_snapshot: " + path + " " + problem);
+        }
+        // the graphs are decoded front to back
+        madvise(const_cast<char *>(data_), length_, MADV_SEQUENTIAL);
+}
+
+graph_snapshot::~graph_snapshot() {
+        if (data_ != nullptr) {
+                munmap(const_cast<char *>(data_), length_);
+        }
+}
@@ -106,10 +106,15 @@ namespace IO {
         nlohmann::json j;
         j["graphlist"] = opt.graphlist;
         j["formulation"] = opt.formulation_name_;
+        j["backend"] = opt.solver_backend_;
         j["constant"] = opt.constant_;
         j["seed"] = opt.seed_;
         j["threads"] = opt.threads_;
+        j["workers"] = opt.workers_;
+        j["steals"] = opt.steals_;
         j["threshold"] = opt.threshold;
+        j["thresholds"] = opt.thresholds;
+        j["ilpPairs"] = opt.ilp_pairs;
         j["Q_filename"] = opt.Q_filename_;
         j["Q_id"] = opt.Q_id_;
         j["Q_Nodes"] = opt.Q_num_nodes_;
@@ -119,15 +124,79 @@ namespace IO {
         j["finalDualBounds"] = opt.lowerbounds;
 
         j["acceptedGraphs"] = opt.accepted_graphs;
+        j["topK"] = opt.top_k_;
+        j["nearestDistances"] = opt.nearest_distances;
+        j["nearestExact"] = opt.nearest_exact;
         j["gurobiNeeded"] = opt.gurobi_needed;
         j["runtimes"] = opt.verification_times;
         j["flatConstraint"] = opt.flat;
         j["accepted_by_heuristic"] = opt.accepted_by_heuristic_;
+        j["warmStart"] = opt.warmstart_;
+        j["reducedCostFixing"] = opt.reduced_cost_fixing_;
+        j["variablesFixed"] = opt.vars_fixed;
+        j["modelVars"] = opt.model_vars;
+        j["modelConstraints"] = opt.model_constrs;
+        j["lpTimes"] = opt.lp_times;
+        j["C2F1"] = opt.addC2F1_;
+        j["C2F2"] = opt.addC2F2_;
+        j["C3"] = opt.addC3_;
+        j["C3onlySub"] = opt.addC3onlySub_;
+        // bound of the root relaxation of the single MIP solve. A pair the cutoff rejects at the root reports at least the
+        // threshold (its finalPrimalBound is DBL_MAX), a solve that ended before the root was solved reports -inf (null)
+        j["rootBounds"] = opt.root_bounds;
+        j["bbNodes"] = opt.bb_nodes;
+        j["branchPrio"] = opt.branchPrio_;
+        j["branchDir"] = opt.branchDirection_;
+        j["InclObjCoefInBranch"] = opt.includeObjCoefIntoFracDegreeBranch;
+        j["boundCache"] = opt.bound_cache_path_;
+        j["decidedByCache"] = opt.decided_by_cache_;
+        j["sparseVariables"] = opt.sparse_variables_;
+        j["solverProfile"] = opt.solver_profile_path_;
+        j["snapshot"] = opt.snapshot_path_;
+        j["archive"] = opt.archive_path_;
+        j["datasetLoadTime"] = opt.dataset_load_time_;
+        j["filterTime"] = opt.filter_time_;
+        j["race"] = opt.race_;
+        j["raceWinners"] = opt.race_winners;
+        j["batchSize"] = opt.batch_size_;
+        j["batchVars"] = opt.batch_vars_;
+        j["batchSizes"] = opt.batch_sizes;
+        j["lagrangian"] = opt.lagrangian_;
+        j["lagrangianIterations"] = opt.lagrangian_iterations_;
+        j["lagrangianBounds"] = opt.lagrangian_bounds;
+        j["lagrangianTimes"] = opt.lagrangian_times;
+        j["rejectedByLagrangian"] = opt.rejected_by_lagrangian_;
+        j["peakRSS_KB"] = opt.peak_rss_kb_;
+        j["RSS_KB"] = opt.rss_kb_;
+        j["allocations"] = opt.allocations_;
         j["preprotimes"] = opt.preprocessing_times_;
 
         return j.dump(4);
     }
 
+    options threshold_output(const options &opt, double threshold) {
+        options out = opt;
+        out.threshold = threshold;
+        // the statistics of the ILP calls stay aligned with the pairs that reached the ILP at the largest threshold
+        out.ilp_pairs = opt.gurobi_needed;
+        out.accepted_graphs.clear();
+        out.gurobi_needed.clear();
+        out.upperbounds.clear();
+        out.lowerbounds.clear();
+        for (std::size_t c = 0; c < opt.graphlist.size(); c++) {
+            if (opt.candidate_upper[c] < threshold + 1e-9) {
+                out.accepted_graphs.push_back(opt.graphlist[c]);
+            }
+            // the ILP was only needed for this threshold if the bounds before it did not reject the pair
+            if (opt.candidate_ilp[c] && opt.candidate_cheap[c] <= threshold) {
+                out.gurobi_needed.push_back(opt.graphlist[c]);
+                out.upperbounds.push_back(opt.candidate_upper[c]);
+                out.lowerbounds.push_back(opt.candidate_lower[c]);
+            }
+        }
+        return out;
+    }
+
     std::string createGurobiOutput(options &opt) {
         nlohmann::json j;
         j["formulation"] = opt.formulation_name_;
@@ -0,0 +1,71 @@
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include <sys/resource.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+
+#include "auxiliary/memory.hpp"
+
+namespace memory {
+
+        std::atomic<std::size_t> allocation_counter{0};
+
+        std::size_t allocations() {
+                return allocation_counter.load(std::memory_order_relaxed);
+        }
+
+        void reset_peak_rss() {
+#ifndef __APPLE__
+                // 5 resets the peak resident set size (VmHWM) to the current one, linux 4.0 and later
+                std::ofstream clear_refs("/proc/self/clear_refs");
+                clear_refs << "5" << std::endl;
+#endif
+        }
+
+        long peak_rss_kb() {
+#ifndef __APPLE__
+                // VmHWM follows reset_peak_rss(), ru_maxrss does not
+                std::ifstream status("/proc/self/status");
+                std::string key;
+                while (status >> key) {
+                        long kb = 0;
+                        if (key == "VmHWM:" and status >> kb) {
+                                return kb;
+                        }
+                        status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                }
+#endif
+                struct rusage usage{};
+                getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+                // bytes on macOS, KB on linux
+                return usage.ru_maxrss / 1024;
+#else
+                return usage.ru_maxrss;
+#endif
+        }
+
+        long current_rss_kb() {
+#ifdef __APPLE__
+                mach_task_basic_info_data_t info{};
+                mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+                if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) {
+                        return 0;
+                }
+                return static_cast<long>(info.resident_size / 1024);
+#else
+                std::ifstream statm("/proc/self/statm");
+                long pages = 0;
+                long resident = 0;
+                if (!(statm >> pages >> resident)) {
+                        return 0;
+                }
+                return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#endif
+        }
+
+} // namespace memory
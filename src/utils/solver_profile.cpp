@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "auxiliary/json.hpp"
+#include "auxiliary/solver_profile.hpp"
+
+namespace {
+        const char *method_name(solver::LpMethod method) {
+                switch (method) {
+                        case solver::LpMethod::PRIMAL_SIMPLEX: return "primal";
+                        case solver::LpMethod::DUAL_SIMPLEX: return "dual";
+                        case solver::LpMethod::BARRIER: return "barrier";
+                        default: return "auto";
+                }
+        }
+
+        solver::LpMethod method_from_name(const std::string &name) {
+                if (name == "primal") return solver::LpMethod::PRIMAL_SIMPLEX;
+                if (name == "dual") return solver::LpMethod::DUAL_SIMPLEX;
+                if (name == "barrier") return solver::LpMethod::BARRIER;
+                if (name == "auto") return solver::LpMethod::AUTOMATIC;
+                throw std::runtime_error("solver_profile: unknown method " + name);
+        }
+}
+
+void solver_profile::setting::apply(solver::MIPSolver &model, int max_threads) const {
+        model.set_lp_method(method);
+        if (presolve >= 0) {
+                model.set_presolve(presolve);
+        }
+        if (cuts >= 0) {
+                model.set_cuts(cuts);
+        }
+        if (heuristics >= 0) {
+                model.set_heuristics(heuristics);
+        }
+        if (threads > 0) {
+                model.set_threads(std::min(threads, std::max(1, max_threads)));
+        }
+}
+
+std::string solver_profile::setting::str() const {
+        std::ostringstream out;
+        out << "method=" << method_name(method) << " presolve=" << presolve << " cuts=" << cuts << " heuristics=" << heuristics
+            << " threads=" << threads;
+        return out.str();
+}
+
+solver_profile solver_profile::load(const std::string &path) {
+        std::ifstream in(path);
+        if (!in) {
+                throw std::runtime_error("solver_profile: can not read " + path);
+        }
+        solver_profile profile;
+        try {
+                nlohmann::json j;
+                in >> j;
+                profile.context = j.at("context").get<std::string>();
+                for (const auto &b: j.at("buckets")) {
+                        bucket entry;
+                        entry.max_vars = b.at("maxVars").get<int>();
+                        entry.params.method = method_from_name(b.at("method").get<std::string>());
+                        entry.params.presolve = b.value("presolve", -1);
+                        entry.params.cuts = b.value("cuts", -1);
+                        entry.params.heuristics = b.value("heuristics", -1.0);
+                        entry.params.threads = b.value("threads", 0);
+                        entry.pairs = b.value("pairs", 0);
+                        entry.seconds = b.value("seconds", 0.0);
+                        profile.buckets.push_back(entry);
+                }
+        } catch (nlohmann::json::exception &e) {
+                throw std::runtime_error("solver_profile: " + path + " is not a profile: " + e.what());
+        }
+        std::sort(profile.buckets.begin(), profile.buckets.end(), [](const bucket &a, const bucket &b) { return a.max_vars < b.max_vars; });
+        return profile;
+}
+
+void solver_profile::save(const std::string &path) const {
+        nlohmann::json j;
+        j["context"] = context;
+        j["buckets"] = nlohmann::json::array();
+        for (const auto &b: buckets) {
+                j["buckets"].push_back({{"maxVars", b.max_vars},
+                                        {"method", method_name(b.params.method)},
+                                        {"presolve", b.params.presolve},
+                                        {"cuts", b.params.cuts},
+                                        {"heuristics", b.params.heuristics},
+                                        {"threads", b.params.threads},
+                                        {"pairs", b.pairs},
+                                        {"seconds", b.seconds}});
+        }
+        std::ofstream out(path);
+        if (!out) {
+                throw std::runtime_error("solver_profile: can not write " + path);
+        }
+        out << j.dump(4) << std::endl;
+}
+
+const solver_profile::setting *solver_profile::find(int vars) const {
+        if (buckets.empty()) {
+                return nullptr;
+        }
+        for (const auto &b: buckets) {
+                if (vars <= b.max_vars) {
+                        return &b.params;
+                }
+        }
+        return &buckets.back().params;
+}
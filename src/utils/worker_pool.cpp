@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <numeric>
+
+#include "auxiliary/worker_pool.hpp"
+
+worker_pool::worker_pool(int workers) {
+        queues_.push_back(std::make_unique<queue>());
+        for (int w = 1; w < workers; w++) {
+                queues_.push_back(std::make_unique<queue>());
+                threads_.emplace_back([this, w] { loop(w); });
+        }
+}
+
+worker_pool::~worker_pool() {
+        {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &thread: threads_) {
+                thread.join();
+        }
+}
+
+void worker_pool::run(std::size_t count, const std::function<void(int, std::size_t)> &body, const std::vector<double> &cost) {
+        {
+                std::lock_guard<std::mutex> lock(mutex_);
+                cost_ = cost.size() == count ? cost : std::vector<double>(count, 1.0);
+                std::vector<std::size_t> order(count);
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) { return cost_[a] > cost_[b]; });
+                for (auto &q: queues_) {
+                        q->remaining = 0.0;
+                }
+                // longest processing time first: every iteration goes to the queue with the least cost so far
+                for (std::size_t i: order) {
+                        auto least = std::min_element(queues_.begin(), queues_.end(), [](const auto &a, const auto &b) { return a->remaining < b->remaining; });
+                        (*least)->tasks.push_back(i);
+                        (*least)->remaining += cost_[i];
+                }
+                body_ = &body;
+                busy_ = threads_.size();
+                steals_ = 0;
+                error_ = nullptr;
+                generation_++;
+        }
+        wake_.notify_all();
+        drain(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return busy_ == 0; });
+        body_ = nullptr;
+        if (error_) {
+                std::exception_ptr error = error_;
+                error_ = nullptr;
+                std::rethrow_exception(error);
+        }
+}
+
+void worker_pool::loop(int worker) {
+        std::size_t seen = 0;
+        while (true) {
+                {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                        if (stop_) {
+                                return;
+                        }
+                        seen = generation_;
+                }
+                drain(worker);
+                {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        busy_--;
+                }
+                done_.notify_one();
+        }
+}
+
+void worker_pool::drain(int worker) {
+        std::size_t i;
+        while (next(worker, i)) {
+                try {
+                        (*body_)(worker, i);
+                } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if (!error_) {
+                                error_ = std::current_exception();
+                        }
+                        // nobody starts the remaining iterations
+                        for (auto &q: queues_) {
+                                std::lock_guard<std::mutex> queue_lock(q->mutex);
+                                q->tasks.clear();
+                                q->remaining = 0.0;
+                        }
+                }
+        }
+}
+
+bool worker_pool::next(int worker, std::size_t &i) {
+        {
+                auto &own = *queues_[worker];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.tasks.empty()) {
+                        i = own.tasks.front();
+                        own.tasks.pop_front();
+                        own.remaining -= cost_[i];
+                        return true;
+                }
+        }
+        while (true) {
+                // the victim is the queue with the most remaining cost, it may be emptied before we lock it
+                queue *victim = nullptr;
+                double most = 0.0;
+                for (auto &q: queues_) {
+                        std::lock_guard<std::mutex> lock(q->mutex);
+                        if (!q->tasks.empty() && (victim == nullptr || q->remaining > most)) {
+                                victim = q.get();
+                                most = q->remaining;
+                        }
+                }
+                if (victim == nullptr) {
+                        return false;
+                }
+                std::lock_guard<std::mutex> lock(victim->mutex);
+                if (!victim->tasks.empty()) {
+                        i = victim->tasks.front();
+                        victim->tasks.pop_front();
+                        victim->remaining -= cost_[i];
+                        steals_++;
+                        return true;
+                }
+        }
+}
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include "auxiliary/zip_archive.hpp"
+
+namespace {
+        constexpr std::uint32_t local_header_signature = 0x04034b50;
+        constexpr std::uint32_t central_header_signature = 0x02014b50;
+        constexpr std::uint32_t end_of_directory_signature = 0x06054b50;
+        /// end of central directory record without comment, the comment may add up to 0xffff bytes
+        constexpr std::size_t end_of_directory_size = 22;
+
+        /// zip fields are little endian, independent of the machine
+        std::uint32_t read_le(const std::string &data, std::size_t offset, int bytes) {
+                if (offset + bytes > data.size()) {
+                        throw std::runtime_error("zip_archive: record exceeds the archive");
+                }
+                std::uint32_t value = 0;
+                for (int b = bytes - 1; b >= 0; b--) {
+                        value = (value << 8) | static_cast<unsigned char>(data[offset + b]);
+                }
+                return value;
+        }
+}
+
+zip_archive::zip_archive(const std::string &path) : path_(path) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+                throw std::runtime_error("zip_archive: could not open " + path);
+        }
+        data_.resize(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0);
+        if (!in.read(data_.data(), static_cast<std::streamsize>(data_.size()))) {
+                throw std::runtime_error("zip_archive: could not read " + path);
+        }
+
+        // the end of central directory record is the last record, followed only by the archive comment
+        if (data_.size() < end_of_directory_size) {
+                throw std::runtime_error("zip_archive: " + path + " is not a zip archive");
+        }
+        std::size_t end = data_.size() - end_of_directory_size;
+        const std::size_t lowest = data_.size() > end_of_directory_size + 0xffff ? data_.size() - end_of_directory_size - 0xffff : 0;
+        while (read_le(data_, end, 4) != end_of_directory_signature) {
+                if (end == lowest) {
+                        throw std::runtime_error("zip_archive: " + path + " is not a zip archive");
+                }
+                end--;
+        }
+        const std::uint32_t count = read_le(data_, end + 10, 2);
+        const std::uint32_t directory_offset = read_le(data_, end + 16, 4);
+        if (count == 0xffff || directory_offset == 0xffffffff) {
+                throw std::runtime_error("zip_archive: " + path + " is a zip64 archive, which is not supported");
+        }
+
+        entries_.reserve(count);
+        std::size_t offset = directory_offset;
+        for (std::uint32_t i = 0; i < count; i++) {
+                if (read_le(data_, offset, 4) != central_header_signature) {
+                        throw std::runtime_error("zip_archive: corrupt central directory in " + path);
+                }
+                entry e;
+                const std::uint32_t flags = read_le(data_, offset + 8, 2);
+                e.method = static_cast<std::uint16_t>(read_le(data_, offset + 10, 2));
+                e.crc = read_le(data_, offset + 16, 4);
+                e.compressed_size = read_le(data_, offset + 20, 4);
+                e.size = read_le(data_, offset + 24, 4);
+                const std::uint32_t name_length = read_le(data_, offset + 28, 2);
+                const std::uint32_t extra_length = read_le(data_, offset + 30, 2);
+                const std::uint32_t comment_length = read_le(data_, offset + 32, 2);
+                e.local_header_offset = read_le(data_, offset + 42, 4);
+                e.name = data_.substr(offset + 46, name_length);
+                if (flags & 1u) {
+                        throw std::runtime_error("zip_archive: " + e.name + " in " + path + " is encrypted");
+                }
+                // the real sizes and offset of a zip64 entry are in its extra field
+                if (e.compressed_size == 0xffffffff || e.size == 0xffffffff || e.local_header_offset == 0xffffffff) {
+                        throw std::runtime_error("zip_archive: " + e.name + " in " + path + " is a zip64 entry, which is not supported");
+                }
+                entries_.push_back(std::move(e));
+                offset += 46 + name_length + extra_length + comment_length;
+        }
+}
+
+std::string zip_archive::extract(const entry &e) const {
+        const std::size_t local = e.local_header_offset;
+        if (read_le(data_, local, 4) != local_header_signature) {
+                throw std::runtime_error("zip_archive: corrupt local header of " + e.name + " in " + path_);
+        }
+        const std::size_t begin = local + 30 + read_le(data_, local + 26, 2) + read_le(data_, local + 28, 2);
+        if (begin + e.compressed_size > data_.size()) {
+                throw std::runtime_error("zip_archive: " + e.name + " exceeds " + path_);
+        }
+
+        std::string out(e.size, '\0');
+        if (e.method == 0) {
+                // a stored entry larger than its data would be read past the end of it
+                if (e.size != e.compressed_size) {
+                        throw std::runtime_error("zip_archive: stored entry " + e.name + " in " + path_ + " has a size mismatch");
+                }
+                std::copy_n(data_.data() + begin, e.size, out.data());
+        } else if (e.method == Z_DEFLATED) {
+                z_stream stream{};
+                // negative window bits: raw deflate data without zlib header, as stored in zip archives
+                if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+                        throw std::runtime_error("zip_archive: inflateInit2 failed");
+                }
+                stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data_.data() + begin));
+                stream.avail_in = static_cast<uInt>(e.compressed_size);
+                stream.next_out = reinterpret_cast<Bytef *>(out.data());
+                stream.avail_out = static_cast<uInt>(out.size());
+                const int status = inflate(&stream, Z_FINISH);
+                inflateEnd(&stream);
+                if (status != Z_STREAM_END || stream.total_out != e.size) {
+                        throw std::runtime_error("zip_archive: could not inflate " + e.name + " in " + path_);
+                }
+        } else {
+                throw std::runtime_error("zip_archive: " + e.name + " in " + path_ + " uses compression method " + std::to_string(e.method));
+        }
+        if (crc32(0L, reinterpret_cast<const Bytef *>(out.data()), static_cast<uInt>(out.size())) != e.crc) {
+                throw std::runtime_error("zip_archive: CRC mismatch for " + e.name + " in " + path_);
+        }
+        return out;
+}
@@ -0,0 +1,43 @@
+#ifndef GEDC_TESTS_CHECK_HPP
+#define GEDC_TESTS_CHECK_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+/**
+ * checks of the test executables. A failed check is reported and counted but does not stop the test, main returns
+ * failures() so that ctest sees every failure of a run at once.
+ */
+inline int &failures() {
+        static int count = 0;
+        return count;
+}
+
+#define CHECK(condition)                                                                                                       \
+        do {                                                                                                                   \
+                if (!(condition)) {                                                                                            \
+                        std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl;             \
+                        failures()++;                                                                                          \
+                }                                                                                                              \
+        } while (false)
+
+/// statement has to throw a std::runtime_error
+#define CHECK_THROWS(statement)                                                                                                \
+        do {                                                                                                                   \
+                bool thrown = false;                                                                                           \
+                try {                                                                                                          \
+                        statement;                                                                                             \
+                } catch (std::runtime_error &) {                                                                               \
+                        thrown = true;                                                                                         \
+                }                                                                                                              \
+                if (!thrown) {                                                                                                 \
+                        std::cerr << __FILE__ << ":" << __LINE__ << ": " #statement " did not throw" << std::endl;             \
+                        failures()++;                                                                                          \
+                }                                                                                                              \
+        } while (false)
+
+/// @brief the data directory of the repository, passed by ctest as the first argument
+inline std::string data_dir(int argc, char **argv) { return argc > 1 ? argv[1] : "../data"; }
+
+#endif //GEDC_TESTS_CHECK_HPP
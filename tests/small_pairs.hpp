@@ -0,0 +1,145 @@
+#ifndef GEDC_TESTS_SMALL_PAIRS_HPP
+#define GEDC_TESTS_SMALL_PAIRS_HPP
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "auxiliary/graph.hpp"
+
+/**
+ * random pairs of small labelled graphs with non-uniform edit costs, and the exact optimum of the verification ILP
+ * found by enumerating every node mapping. Small enough (at most 5 nodes) for the enumeration to take microseconds.
+ */
+
+/// edit costs of a pair in the layout of graph::cost_function
+struct pair_costs {
+        std::vector<std::vector<double>> c_ik;
+        std::vector<double> c_ie;
+        std::vector<double> c_ek;
+        std::vector<std::vector<double>> c_ijkl;
+        std::vector<double> c_ije;
+        std::vector<double> c_ekl;
+};
+
+inline graph<int, int> random_graph(std::mt19937 &rng, int nodes, double density, int labels) {
+        graph<int, int> G;
+        std::uniform_int_distribution<int> label(0, labels - 1);
+        std::bernoulli_distribution edge(density);
+        for (int i = 0; i < nodes; i++) {
+                G.add_node(i, label(rng));
+        }
+        for (int i = 0; i < nodes; i++) {
+                for (int j = i + 1; j < nodes; j++) {
+                        if (edge(rng)) {
+                                G.add_edge(i, j, label(rng));
+                        }
+                }
+        }
+        return G;
+}
+
+/// @brief substitutions of equal labels are free, every other operation costs between 0.5 and 2
+inline pair_costs random_costs(std::mt19937 &rng, graph<int, int> &G, graph<int, int> &H) {
+        std::uniform_real_distribution<double> cost(0.5, 2.0);
+        pair_costs c;
+        c.c_ik.assign(G.number_of_nodes(), std::vector<double>(H.number_of_nodes(), 0.0));
+        for (int i = 0; i < G.number_of_nodes(); i++) {
+                for (int k = 0; k < H.number_of_nodes(); k++) {
+                        c.c_ik[i][k] = G.get_node_label(i) == H.get_node_label(k) ? 0.0 : cost(rng);
+                }
+        }
+        c.c_ijkl.assign(G.number_of_edges(), std::vector<double>(H.number_of_edges(), 0.0));
+        for (int ij = 0; ij < G.number_of_edges(); ij++) {
+                for (int kl = 0; kl < H.number_of_edges(); kl++) {
+                        c.c_ijkl[ij][kl] = G.get_edge_label(ij) == H.get_edge_label(kl) ? 0.0 : cost(rng);
+                }
+        }
+        for (int i = 0; i < G.number_of_nodes(); i++) c.c_ie.push_back(cost(rng));
+        for (int k = 0; k < H.number_of_nodes(); k++) c.c_ek.push_back(cost(rng));
+        for (int ij = 0; ij < G.number_of_edges(); ij++) c.c_ije.push_back(cost(rng));
+        for (int kl = 0; kl < H.number_of_edges(); kl++) c.c_ekl.push_back(cost(rng));
+        return c;
+}
+
+/**
+ * cost of the best solution of the verification ILP with node mapping map (map[i] = node of H or -1 for deletion): an
+ * edge whose end points are mapped onto an edge of H is substituted or deleted and inserted, whichever is cheaper
+ */
+inline double mapping_cost(graph<int, int> &G, graph<int, int> &H, const pair_costs &c, const std::vector<int> &map) {
+        double cost = 0.0;
+        std::vector<bool> covered(H.number_of_nodes(), false);
+        for (int i = 0; i < G.number_of_nodes(); i++) {
+                if (map[i] < 0) {
+                        cost += c.c_ie[i];
+                } else {
+                        cost += c.c_ik[i][map[i]];
+                        covered[map[i]] = true;
+                }
+        }
+        for (int k = 0; k < H.number_of_nodes(); k++) {
+                if (!covered[k]) {
+                        cost += c.c_ek[k];
+                }
+        }
+        std::vector<bool> matched(H.number_of_edges(), false);
+        for (int ij = 0; ij < G.number_of_edges(); ij++) {
+                auto [i, j] = G.get_edge(ij);
+                cost += c.c_ije[ij];
+                if (map[i] < 0 or map[j] < 0 or not H.has_edge(map[i], map[j])) {
+                        continue;
+                }
+                for (int kl = 0; kl < H.number_of_edges(); kl++) {
+                        auto [k, l] = H.get_edge(kl);
+                        if ((k == map[i] and l == map[j]) or (k == map[j] and l == map[i])) {
+                                if (c.c_ijkl[ij][kl] < c.c_ije[ij] + c.c_ekl[kl]) {
+                                        cost += c.c_ijkl[ij][kl] - c.c_ije[ij];
+                                        matched[kl] = true;
+                                }
+                        }
+                }
+        }
+        for (int kl = 0; kl < H.number_of_edges(); kl++) {
+                if (!matched[kl]) {
+                        cost += c.c_ekl[kl];
+                }
+        }
+        return cost;
+}
+
+/// @brief calls f(map) for every partial injective mapping of the nodes of G onto the nodes of H
+inline void for_each_mapping(int n_g, int n_h, const std::function<void(const std::vector<int> &)> &f) {
+        std::vector<int> map(n_g, -1);
+        std::vector<bool> used(n_h, false);
+        std::function<void(int)> extend = [&](int i) {
+                if (i == n_g) {
+                        f(map);
+                        return;
+                }
+                map[i] = -1;
+                extend(i + 1);
+                for (int k = 0; k < n_h; k++) {
+                        if (!used[k]) {
+                                used[k] = true;
+                                map[i] = k;
+                                extend(i + 1);
+                                used[k] = false;
+                        }
+                }
+                map[i] = -1;
+        };
+        extend(0);
+}
+
+/// @brief optimum of the verification ILP of the pair, the exact GED under these costs
+inline double exact_ged(graph<int, int> &G, graph<int, int> &H, const pair_costs &c) {
+        double best = std::numeric_limits<double>::infinity();
+        for_each_mapping(G.number_of_nodes(), H.number_of_nodes(), [&](const std::vector<int> &map) {
+                best = std::min(best, mapping_cost(G, H, c, map));
+        });
+        return best;
+}
+
+#endif //GEDC_TESTS_SMALL_PAIRS_HPP
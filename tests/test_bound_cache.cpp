@@ -0,0 +1,99 @@
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "auxiliary/bound_cache.hpp"
+#include "check.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * bound_cache keeps the tightest bounds per pair and context across instances sharing one file, and survives a torn
+ * tail left by a process that died in the middle of a write: readers skip the partial record, and the next writer pads
+ * it so that its own record stays aligned and readable.
+ */
+
+const double unknown = std::numeric_limits<double>::max();
+
+/// @brief appends the first bytes of a record of another writer, as if it died in the middle of write()
+void tear(const std::string &path, std::size_t bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        const std::vector<char> partial(bytes, '\x7f');
+        out.write(partial.data(), static_cast<std::streamsize>(partial.size()));
+}
+
+void test_tightest_bounds(const std::string &path) {
+        fs::remove(path);
+        bound_cache a(path, "aids/uniform");
+        a.add(1, 2, 3.0, unknown);
+        a.add(1, 2, 2.0, 8.0);
+        a.add(1, 2, 4.0, 9.0);
+        a.add(2, 1, 0.0, 5.0);
+        CHECK(a.size() == 2);
+        CHECK(a.find(1, 2).lower == 4.0 && a.find(1, 2).upper == 8.0);
+        CHECK(!a.find(1, 2).exact());
+        // only records that tightened a bound are written
+        CHECK(fs::file_size(path) == 4 * 32);
+
+        bound_cache b(path, "aids/uniform");
+        CHECK(b.find(1, 2).lower == 4.0 && b.find(1, 2).upper == 8.0);
+        CHECK(b.find(2, 1).upper == 5.0);
+        CHECK(b.find(3, 3).lower == 0.0 && b.find(3, 3).upper == unknown);
+        b.add(1, 2, 6.0, 6.0);
+        CHECK(a.find(1, 2).exact() && a.find(1, 2).lower == 6.0);
+
+        // another context does not see the records
+        bound_cache other(path, "muta/uniform");
+        CHECK(other.size() == 0);
+        CHECK(other.find(1, 2).upper == unknown);
+}
+
+void test_torn_tail(const std::string &path) {
+        fs::remove(path);
+        bound_cache writer(path, "aids/uniform");
+        writer.add(1, 2, 3.0, 7.0);
+        writer.add(4, 5, 1.0, unknown);
+        bound_cache open_before(path, "aids/uniform");
+        tear(path, 20);
+        CHECK(fs::file_size(path) == 2 * 32 + 20);
+
+        // a new reader takes the whole records and ignores the partial one
+        bound_cache reader(path, "aids/uniform");
+        CHECK(reader.size() == 2);
+        CHECK(reader.find(1, 2).lower == 3.0 && reader.find(1, 2).upper == 7.0);
+        CHECK(reader.find(4, 5).lower == 1.0);
+        open_before.refresh();
+        CHECK(open_before.size() == 2);
+
+        // the next record is padded to the record size and read by everybody, the padded partial record is not
+        writer.add(6, 7, 2.0, 2.0);
+        CHECK(fs::file_size(path) == 4 * 32);
+        CHECK(reader.find(6, 7).exact() && reader.find(6, 7).lower == 2.0);
+        CHECK(open_before.find(6, 7).exact());
+        CHECK(reader.size() == 3 && open_before.size() == 3);
+        bound_cache after(path, "aids/uniform");
+        CHECK(after.size() == 3);
+        CHECK(after.find(1, 2).upper == 7.0 && after.find(6, 7).upper == 2.0);
+
+        // a torn tail of a single byte, and one of all but the last byte of a record
+        std::size_t pairs = 3;
+        for (std::size_t bytes: {std::size_t{1}, std::size_t{31}}) {
+                tear(path, bytes);
+                bound_cache torn(path, "aids/uniform");
+                CHECK(torn.size() == pairs++);
+                writer.add(8, bytes, 1.0, 1.0);
+                CHECK(fs::file_size(path) % 32 == 0);
+                CHECK(torn.find(8, bytes).exact());
+        }
+}
+
+int main() {
+        const std::string path = (fs::temp_directory_path() / "gedc_test_bound_cache.bin").string();
+        test_tightest_bounds(path);
+        test_torn_tail(path);
+        CHECK_THROWS(bound_cache((fs::temp_directory_path() / "gedc_missing_dir" / "cache.bin").string(), "aids/uniform"));
+        fs::remove(path);
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "auxiliary/GXLGraphReader.hpp"
+#include "auxiliary/dataset_registry.hpp"
+#include "auxiliary/graph_database.hpp"
+#include "check.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * dataset_registry binds the graphs of a database to their collection position by file name only. The Mutagenicity
+ * archive holds molecule_test_1.gxl and molecule_test_2.gxl, which the collection does not list and whose ids clash with
+ * molecule_1.gxl and molecule_2.gxl.
+ */
+
+/// @brief writes a collection XML listing files to a temporary file and returns its path
+std::string write_collection(const std::string &name, const std::vector<std::string> &files) {
+        const fs::path path = fs::temp_directory_path() / name;
+        std::ofstream out(path);
+        out << "<?xml version=\"1.0\"?>\n<GraphCollection>\n";
+        for (const auto &file: files) {
+                out << "\t<graph file=\"" << file << "\" class=\"a\"/>\n";
+        }
+        out << "</GraphCollection>\n";
+        return path.string();
+}
+
+void test_file_id() {
+        CHECK(dataset_registry::file_id("435.gxl") == 435);
+        CHECK(dataset_registry::file_id("molecule_435.gxl") == 435);
+        CHECK(dataset_registry::file_id("molecule_test_1.gxl") == 1);
+        CHECK(dataset_registry::file_id("graph.gxl") == 0);
+}
+
+void test_collection(const std::string &data) {
+        dataset_registry registry(data + "/collections/allMutagenicity.xml");
+        CHECK(registry.size() == 4337);
+        CHECK(!registry.contains("molecule_test_1.gxl"));
+        CHECK(registry.file(registry.position("molecule_1.gxl")) == "molecule_1.gxl");
+        CHECK(registry.position_of_id(1) == registry.position("molecule_1.gxl"));
+        CHECK(registry.id(registry.position("molecule_4116.gxl")) == 4116);
+        CHECK_THROWS(static_cast<void>(registry.position("molecule_test_1.gxl")));
+
+        CHECK_THROWS(dataset_registry(write_collection("gedc_twice.xml", {"molecule_1.gxl", "molecule_1.gxl"})));
+        CHECK_THROWS(dataset_registry(write_collection("gedc_id_twice.xml", {"molecule_1.gxl", "molecule_test_1.gxl"})));
+}
+
+void test_bind(const std::string &data) {
+        const std::string archive = data + "/Mutagenicity/MutaGXL.zip";
+        dataset_registry registry(write_collection("gedc_bind.xml", {"molecule_1.gxl", "molecule_2.gxl", "molecule_3.gxl"}));
+
+        // the database order differs from the collection order
+        auto db = GraphDatabase<std::string, int>::from_zip(archive, GXLGraphReader::parse_mutagenicity,
+                                                            {"molecule_3.gxl", "molecule_1.gxl", "molecule_2.gxl"});
+        registry.bind(db);
+        CHECK(registry.graph_position(0) == 2);
+        CHECK(registry.graph_position(1) == 0);
+        CHECK(registry.graph_position(2) == 1);
+        registry.set_gedlib_ids({10, 11, 12});
+        CHECK(registry.graph_gedlib_id(0) == 12);
+        CHECK(registry.graph_gedlib_id(1) == 10);
+        CHECK_THROWS(registry.set_gedlib_ids({10, 11}));
+
+        // molecule_test_1.gxl has the id of molecule_1.gxl, it must not be bound to it
+        auto test_db = GraphDatabase<std::string, int>::from_zip(archive, GXLGraphReader::parse_mutagenicity, {"molecule_2.gxl", "molecule_test_1.gxl"});
+        CHECK_THROWS(registry.bind(test_db));
+
+        // ids are unique within a database
+        CHECK_THROWS((GraphDatabase<std::string, int>::from_zip(archive, GXLGraphReader::parse_mutagenicity, {"molecule_1.gxl", "molecule_test_1.gxl"})));
+}
+
+int main(int argc, char **argv) {
+        const std::string data = data_dir(argc, argv);
+        test_file_id();
+        test_collection(data);
+        test_bind(data);
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "auxiliary/GXLGraphReader.hpp"
+#include "auxiliary/dataset_registry.hpp"
+#include "auxiliary/filter_tiles.hpp"
+#include "auxiliary/get_lower_bound.hpp"
+#include "auxiliary/graph_database.hpp"
+#include "auxiliary/worker_pool.hpp"
+#include "check.hpp"
+
+/**
+ * filter_index has to return exactly the bounds of compute_lower_bound(), including the values of its early exits, for
+ * every upper bound and whether the tiles run on a worker_pool or not.
+ */
+
+template<typename T, typename U>
+void compare(const GraphDatabase<T, U> &db, std::size_t queries, worker_pool &pool) {
+        filter_index<T, U> index;
+        std::vector<filter_signature> query_signatures;
+        std::vector<filter_signature> candidate_signatures;
+        for (std::size_t c = 0; c < db.size(); c++) {
+                candidate_signatures.push_back(index.signature(db.get(c)));
+        }
+        for (std::size_t q = 0; q < queries; q++) {
+                query_signatures.push_back(candidate_signatures[q]);
+        }
+
+        for (unsigned int upper: {0u, 2u, 5u, 10u, std::numeric_limits<unsigned int>::max()}) {
+                const auto bounds = filter_index<T, U>::lower_bounds(query_signatures, candidate_signatures, upper);
+                const auto pooled = filter_index<T, U>::lower_bounds(query_signatures, candidate_signatures, upper, &pool);
+                CHECK(bounds == pooled);
+                std::size_t mismatches = 0;
+                for (std::size_t q = 0; q < queries; q++) {
+                        for (std::size_t c = 0; c < db.size(); c++) {
+                                if (bounds[q][c] != compute_lower_bound(db.get(q), db.get(c), upper)) {
+                                        mismatches++;
+                                }
+                        }
+                }
+                CHECK(mismatches == 0);
+                for (std::size_t q = 0; q < queries; q++) {
+                        CHECK(bounds[q][q] == 0);
+                }
+        }
+}
+
+int main(int argc, char **argv) {
+        const std::string data = data_dir(argc, argv);
+        worker_pool pool(4);
+
+        // the first graphs of each collection, more than one tile of candidates
+        auto first = [](const std::string &collection, std::size_t count) {
+                auto files = dataset_registry::collection_files(collection);
+                files.resize(std::min(files.size(), count));
+                return files;
+        };
+        auto aids = GraphDatabase<std::string, int>::from_zip(data + "/AIDS/AIDSGXL.zip", GXLGraphReader::parse_AIDS,
+                                                              first(data + "/collections/allAIDS.xml", 200));
+        compare(aids, 40, pool);
+        auto muta = GraphDatabase<std::string, int>::from_zip(data + "/Mutagenicity/MutaGXL.zip", GXLGraphReader::parse_mutagenicity,
+                                                              first(data + "/collections/allMutagenicity.xml", 200));
+        compare(muta, 40, pool);
+        return failures() == 0 ? 0 : 1;
+}
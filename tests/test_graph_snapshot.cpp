@@ -0,0 +1,74 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "auxiliary/GXLGraphReader.hpp"
+#include "auxiliary/dataset_registry.hpp"
+#include "auxiliary/graph_database.hpp"
+#include "check.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * a database written with save_snapshot() and loaded with from_snapshot() has to hold the same graphs as the one parsed
+ * from the GXL files: files, ids, signatures, labels, edge order, neighbour order and original node ids.
+ */
+
+template<typename T, typename U>
+void round_trip(GraphDatabase<T, U> &parsed, const std::string &name) {
+        const std::string path = (fs::temp_directory_path() / name).string();
+        parsed.save_snapshot(path);
+        auto loaded = GraphDatabase<T, U>::from_snapshot(path);
+
+        CHECK(loaded.size() == parsed.size());
+        CHECK(loaded.files() == parsed.files());
+        std::size_t differences = 0;
+        for (std::size_t g = 0; g < parsed.size() && g < loaded.size(); g++) {
+                auto &G = parsed.get(g);
+                auto &L = loaded.get(g);
+                CHECK(loaded.id(g) == parsed.id(g));
+                CHECK(loaded.index(parsed.file(g)) == static_cast<long>(g));
+                CHECK(loaded.sig(g).nodes == parsed.sig(g).nodes && loaded.sig(g).edges == parsed.sig(g).edges &&
+                      loaded.sig(g).max_degree == parsed.sig(g).max_degree);
+                CHECK(L.get_graph_id() == G.get_graph_id());
+                CHECK(L.get_dataset() == G.get_dataset());
+                if (L.number_of_nodes() != G.number_of_nodes() || L.number_of_edges() != G.number_of_edges()) {
+                        differences++;
+                        continue;
+                }
+                for (node i = 0; i < G.number_of_nodes(); i++) {
+                        const node v = G.get_node(i);
+                        if (L.get_node(i) != v || !(L.get_node_label(v) == G.get_node_label(v)) ||
+                            L.get_original_nodeID(v) != G.get_original_nodeID(v) || L.get_neighbors(v) != G.get_neighbors(v)) {
+                                differences++;
+                        }
+                }
+                for (idx ij = 0; ij < G.number_of_edges(); ij++) {
+                        if (L.get_edge(ij) != G.get_edge(ij) || !(L.get_edge_label(ij) == G.get_edge_label(ij))) {
+                                differences++;
+                        }
+                }
+        }
+        CHECK(differences == 0);
+        fs::remove(path);
+
+        // a snapshot only loads into the label types it was written with
+        parsed.save_snapshot(path);
+        CHECK_THROWS((GraphDatabase<int, int>::from_snapshot(path)));
+        fs::remove(path);
+}
+
+int main(int argc, char **argv) {
+        const std::string data = data_dir(argc, argv);
+
+        // the graphs of the collection, as the engine loads them
+        auto aids = GraphDatabase<std::string, int>::from_zip(data + "/AIDS/AIDSGXL.zip", GXLGraphReader::parse_AIDS,
+                                                              dataset_registry::collection_files(data + "/collections/allAIDS.xml"));
+        round_trip(aids, "gedc_aids.snapshot");
+        auto muta = GraphDatabase<std::string, int>::from_zip(data + "/Mutagenicity/MutaGXL.zip", GXLGraphReader::parse_mutagenicity,
+                                                              dataset_registry::collection_files(data + "/collections/allMutagenicity.xml"));
+        round_trip(muta, "gedc_muta.snapshot");
+
+        CHECK_THROWS((GraphDatabase<std::string, int>::from_snapshot(data + "/collections/allAIDS.xml")));
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+#include <cmath>
+#include <limits>
+
+#include "solver/HighsSolver.hpp"
+#include "check.hpp"
+
+/**
+ * the HiGHS backend solves the declared binaries as integers: a model whose LP relaxation is within the threshold but
+ * whose integer optimum is not has to be rejected, as it is by the verification ILP. The model is the vertex cover of a
+ * triangle, LP optimum 1.5 with every variable at 0.5, integer optimum 2.
+ */
+
+namespace {
+        const double threshold = 1.5;
+
+        /// min x0 + x1 + x2 s.t. x_a + x_b >= 1 for every pair, optionally with the threshold row of the verification ILP
+        void triangle_cover(solver::HighsSolver &model, bool threshold_row) {
+                solver::LinExpr objfunc;
+                for (int v = 0; v < 3; v++) {
+                        objfunc.add(model.add_var(0, 1, 1.0, true, "x" + std::to_string(v)));
+                }
+                for (int a = 0; a < 3; a++) {
+                        solver::LinExpr edge;
+                        edge.add(a);
+                        edge.add((a + 1) % 3);
+                        model.add_constr(edge, solver::Sense::GREATER_EQUAL, 1, "cover_" + std::to_string(a));
+                }
+                if (threshold_row) {
+                        model.add_constr(objfunc, solver::Sense::LESS_EQUAL, threshold, "threshold");
+                        model.set_cutoff(threshold + 1e-6);
+                }
+        }
+}
+
+int main() {
+        // the optimum is integral
+        {
+                solver::HighsSolver model;
+                triangle_cover(model, false);
+                CHECK(model.optimize() == solver::Status::OPTIMAL);
+                CHECK(std::abs(model.obj_val() - 2.0) < 1e-6);
+                for (int v = 0; v < 3; v++) {
+                        CHECK(std::abs(model.value(v) - std::round(model.value(v))) < 1e-6);
+                }
+        }
+        // the relaxation is within the threshold, the integer model is not
+        {
+                solver::HighsSolver model;
+                triangle_cover(model, true);
+                auto status = model.optimize();
+                CHECK(status == solver::Status::INFEASIBLE or status == solver::Status::CUTOFF);
+                CHECK(model.obj_val() == std::numeric_limits<double>::max());
+
+                model.set_integrality(false);
+                model.reset();
+                CHECK(model.optimize() == solver::Status::OPTIMAL);
+                CHECK(std::abs(model.obj_val() - threshold) < 1e-6);
+
+                model.set_integrality(true);
+                model.reset();
+                status = model.optimize();
+                CHECK(status == solver::Status::INFEASIBLE or status == solver::Status::CUTOFF);
+        }
+        return failures() == 0 ? 0 : 1;
+}
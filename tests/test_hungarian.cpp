@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "auxiliary/hungarian.hpp"
+#include "check.hpp"
+
+/**
+ * hungarian() returns an optimal assignment, checked against all permutations of small random matrices, and its
+ * reduced costs are non-negative, zero on the assignment and a valid penalty for forcing a row onto a column.
+ */
+
+/// @brief smallest cost of a permutation with row i on column j, over all permutations if i < 0
+double brute_force(const std::vector<double> &cost, int n, int i = -1, int j = -1) {
+        std::vector<int> perm(n);
+        std::iota(perm.begin(), perm.end(), 0);
+        double best = std::numeric_limits<double>::infinity();
+        do {
+                if (i >= 0 and perm[i] != j) {
+                        continue;
+                }
+                double total = 0.0;
+                for (int r = 0; r < n; r++) {
+                        total += cost[r * n + perm[r]];
+                }
+                best = std::min(best, total);
+        } while (std::next_permutation(perm.begin(), perm.end()));
+        return best;
+}
+
+void test_random(std::mt19937 &rng, bool ties) {
+        std::uniform_real_distribution<double> real(-5.0, 10.0);
+        std::uniform_int_distribution<int> small(0, 3);
+        for (int round = 0; round < 200; round++) {
+                const int n = 1 + round % 6;
+                std::vector<double> cost(n * n);
+                for (auto &c: cost) {
+                        c = ties ? small(rng) : real(rng);
+                }
+                std::vector<int> row_to_col;
+                std::vector<double> rc;
+                const double total = hungarian(cost, n, row_to_col, &rc);
+                const double optimum = brute_force(cost, n);
+                CHECK(std::abs(total - optimum) < 1e-9);
+
+                // row_to_col is a permutation of that cost
+                std::vector<int> sorted = row_to_col;
+                std::sort(sorted.begin(), sorted.end());
+                std::vector<int> identity(n);
+                std::iota(identity.begin(), identity.end(), 0);
+                CHECK(sorted == identity);
+                double assigned = 0.0;
+                for (int r = 0; r < n; r++) {
+                        assigned += cost[r * n + row_to_col[r]];
+                        CHECK(std::abs(rc[r * n + row_to_col[r]]) < 1e-9);
+                }
+                CHECK(std::abs(assigned - total) < 1e-9);
+
+                for (int r = 0; r < n; r++) {
+                        for (int c = 0; c < n; c++) {
+                                CHECK(rc[r * n + c] >= -1e-9);
+                                CHECK(brute_force(cost, n, r, c) >= optimum + rc[r * n + c] - 1e-9);
+                        }
+                }
+        }
+}
+
+void test_known() {
+        // the greedy choice of the smallest entry (row 0 on column 0) is not optimal
+        const std::vector<double> cost{1, 2, 3,
+                                       2, 4, 6,
+                                       3, 6, 9};
+        std::vector<int> row_to_col;
+        CHECK(hungarian(cost, 3, row_to_col) == 10.0);
+        CHECK((row_to_col == std::vector<int>{2, 1, 0}));
+}
+
+int main() {
+        std::mt19937 rng(112358);
+        test_known();
+        test_random(rng, false);
+        test_random(rng, true);
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,43 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "auxiliary/lagrangian_bound.hpp"
+#include "check.hpp"
+#include "small_pairs.hpp"
+
+/**
+ * LAGRANGIAN_BOUND is a lower bound: it never exceeds the exact GED of random small pairs, whether the subgradient
+ * optimization runs all iterations or stops early at the threshold, and it is tight on identical graphs.
+ */
+
+int main() {
+        std::mt19937 rng(314159);
+        int positive = 0;
+        for (int round = 0; round < 300; round++) {
+                std::uniform_int_distribution<int> nodes(1, 5);
+                auto G = random_graph(rng, nodes(rng), 0.5, 3);
+                auto H = random_graph(rng, nodes(rng), 0.5, 3);
+                auto c = random_costs(rng, G, H);
+                const double ged = exact_ged(G, H, c);
+                for (double threshold: {0.0, ged / 2, ged + 100.0}) {
+                        LAGRANGIAN_BOUND<int, int> lagrangian(G, H, c.c_ik, c.c_ie, c.c_ek, c.c_ijkl, c.c_ije, c.c_ekl);
+                        const double bound = lagrangian.bound(threshold, 50);
+                        CHECK(bound <= ged + 1e-6);
+                        if (threshold > ged and bound > 1e-6) {
+                                positive++;
+                        }
+                }
+        }
+        // the bound is not vacuous on these pairs
+        CHECK(positive > 100);
+
+        for (int round = 0; round < 50; round++) {
+                auto G = random_graph(rng, 5, 0.5, 3);
+                auto H = G;
+                auto c = random_costs(rng, G, H);
+                LAGRANGIAN_BOUND<int, int> lagrangian(G, H, c.c_ik, c.c_ie, c.c_ek, c.c_ijkl, c.c_ije, c.c_ekl);
+                CHECK(std::abs(lagrangian.bound(0.0, 50)) < 1e-6);
+        }
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+#include <string>
+#include <vector>
+
+#include "engine/nearest_heap.hpp"
+#include "check.hpp"
+
+/**
+ * nearest_heap keeps the k nearest graphs within the radius, hands them out nearest first and tells top_k() which
+ * threshold the next ILP needs (cap) and whether a lower bound can still improve the result (beats).
+ */
+
+std::vector<double> distances(const std::vector<nearest_graph> &nearest) {
+        std::vector<double> out;
+        for (const auto &n: nearest) {
+                out.push_back(n.distance);
+        }
+        return out;
+}
+
+void test_ordering() {
+        nearest_heap heap(3, 10.0);
+        heap.offer("e.gxl", 7.0, true);
+        heap.offer("a.gxl", 2.0, true);
+        heap.offer("d.gxl", 6.0, false);
+        heap.offer("b.gxl", 3.0, true);
+        heap.offer("c.gxl", 4.0, true);
+        CHECK(heap.size() == 3);
+        const auto nearest = heap.take_sorted();
+        CHECK((distances(nearest) == std::vector<double>{2.0, 3.0, 4.0}));
+        CHECK(nearest.front().file == "a.gxl" && nearest.back().file == "c.gxl");
+        CHECK(heap.size() == 0);
+}
+
+void test_cap_and_beats() {
+        nearest_heap heap(2, 5.0);
+        // below k graphs: anything within the radius, inclusive
+        CHECK(heap.cap() == 5.0);
+        CHECK(heap.beats(5.0));
+        CHECK(!heap.beats(5.5));
+        heap.offer("far.gxl", 4.0, true);
+        CHECK(heap.cap() == 5.0);
+        heap.offer("near.gxl", 1.0, true);
+        // with k graphs: only strictly below the k-th nearest
+        CHECK(heap.cap() == 4.0);
+        CHECK(heap.beats(3.0));
+        CHECK(!heap.beats(4.0));
+        heap.offer("mid.gxl", 2.0, false);
+        CHECK(heap.cap() == 2.0);
+        const auto nearest = heap.take_sorted();
+        CHECK(nearest.size() == 2 && nearest[1].file == "mid.gxl" && !nearest[1].exact);
+}
+
+void test_radius_and_ties() {
+        nearest_heap heap(3, 3.0);
+        heap.offer("outside.gxl", 3.5, true);
+        heap.offer("edge.gxl", 3.0, true);
+        CHECK(heap.size() == 1);
+        // a tie with the k-th nearest does not replace it
+        nearest_heap full(1, 10.0);
+        full.offer("first.gxl", 2.0, true);
+        full.offer("second.gxl", 2.0, true);
+        const auto nearest = full.take_sorted();
+        CHECK(nearest.size() == 1 && nearest[0].file == "first.gxl");
+}
+
+void test_empty() {
+        nearest_heap heap(0, 10.0);
+        CHECK(!heap.beats(0.0));
+        heap.offer("a.gxl", 0.0, true);
+        CHECK(heap.size() == 0);
+        CHECK(heap.take_sorted().empty());
+}
+
+int main() {
+        test_ordering();
+        test_cap_and_beats();
+        test_radius_and_ties();
+        test_empty();
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "auxiliary/node_lower_bounds.hpp"
+#include "check.hpp"
+#include "small_pairs.hpp"
+
+/**
+ * the sparse verification model leaves out x_ik if node_lower_bounds() exceeds the threshold. That must never remove a
+ * solution within the threshold: every node mapping with i -> k costs at least the bound of (i, k).
+ */
+
+int main() {
+        std::mt19937 rng(271828);
+        verification_arena arena;
+        int omitted = 0;
+        int tight = 0;
+        for (int round = 0; round < 300; round++) {
+                std::uniform_int_distribution<int> nodes(1, 5);
+                // every other pair without edges and with free insertions, where the floor of G is often tight
+                const bool node_only = round % 2 == 1;
+                auto G = random_graph(rng, nodes(rng), node_only ? 0.0 : 0.5, 3);
+                auto H = random_graph(rng, nodes(rng), node_only ? 0.0 : 0.5, 3);
+                auto c = random_costs(rng, G, H);
+                if (node_only) {
+                        std::fill(c.c_ek.begin(), c.c_ek.end(), 0.0);
+                }
+                const int n_g = G.number_of_nodes();
+                const int n_h = H.number_of_nodes();
+                // infinite substitution costs are omitted, not bounded
+                if (round % 10 == 0) {
+                        c.c_ik[0][0] = std::numeric_limits<double>::infinity();
+                }
+                node_lower_bounds(arena, n_g, n_h, c.c_ik, c.c_ie, c.c_ek);
+                CHECK(static_cast<int>(arena.node_lb.rows.size()) == n_g);
+
+                // cheapest mapping with i -> k, by enumeration
+                std::vector<std::vector<double>> cheapest(n_g, std::vector<double>(n_h, std::numeric_limits<double>::infinity()));
+                double ged = std::numeric_limits<double>::infinity();
+                for_each_mapping(n_g, n_h, [&](const std::vector<int> &map) {
+                        const double cost = mapping_cost(G, H, c, map);
+                        ged = std::min(ged, cost);
+                        for (int i = 0; i < n_g; i++) {
+                                if (map[i] >= 0) {
+                                        cheapest[i][map[i]] = std::min(cheapest[i][map[i]], cost);
+                                }
+                        }
+                });
+                for (int i = 0; i < n_g; i++) {
+                        for (int k = 0; k < n_h; k++) {
+                                CHECK(arena.node_lb.rows[i][k] <= cheapest[i][k] + 1e-9);
+                                if (std::abs(arena.node_lb.rows[i][k] - cheapest[i][k]) < 1e-9) {
+                                        tight++;
+                                }
+                                if (not (arena.node_lb.rows[i][k] <= ged + 1e-9)) {
+                                        omitted++;
+                                }
+                        }
+                }
+        }
+        // the sparse model is smaller on these pairs even at the tightest threshold
+        CHECK(omitted > 0);
+        CHECK(tight > 0);
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,41 @@
+#include <cmath>
+#include <limits>
+
+#include "auxiliary/pair_difficulty.hpp"
+#include "check.hpp"
+
+/**
+ * pair_difficulty() is positive and finite for any bounds, grows as the threshold gets closer to the bounds known
+ * before the ILP and is largest when the threshold meets one of them.
+ */
+
+int main() {
+        const double unknown = std::numeric_limits<double>::max();
+        const double vars = 99.0;
+        auto sane = [](double d) { return std::isfinite(d) and d > 0.0; };
+
+        // threshold between the bounds: the nearer bound decides
+        CHECK(pair_difficulty(vars, 2.0, 8.0, 5.0) == 100.0 / 4.0);
+        CHECK(pair_difficulty(vars, 4.0, 8.0, 5.0) == 100.0 / 2.0);
+        CHECK(pair_difficulty(vars, 4.0, unknown, 5.0) == 100.0 / 2.0);
+        CHECK(pair_difficulty(vars, 5.0, 5.0, 5.0) == 100.0);
+
+        // the upper bound is below the threshold but did not decide the pair: a gap of the threshold minus the upper bound,
+        // never negative or infinite
+        for (double upper: {4.999, 4.0, 1.0, 0.0}) {
+                const double d = pair_difficulty(vars, 0.0, upper, 5.0);
+                CHECK(sane(d));
+                CHECK(d == 100.0 / (1.0 + 5.0 - upper));
+                CHECK(d <= 100.0);
+        }
+        CHECK(pair_difficulty(vars, 0.0, 4.0, 5.0) > pair_difficulty(vars, 0.0, 1.0, 5.0));
+
+        // the lower bound is above the threshold
+        CHECK(pair_difficulty(vars, 7.0, unknown, 5.0) == 100.0 / 3.0);
+
+        // the hardest pairs of equal size are those whose bounds meet the threshold
+        CHECK(pair_difficulty(vars, 5.0, unknown, 5.0) == 100.0);
+        CHECK(pair_difficulty(vars, 0.0, 5.0, 5.0) == 100.0);
+        CHECK(pair_difficulty(0.0, 0.0, unknown, 0.0) == 1.0);
+        return failures() == 0 ? 0 : 1;
+}
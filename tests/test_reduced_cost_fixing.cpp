@@ -0,0 +1,50 @@
+#include <random>
+#include <vector>
+
+#include "auxiliary/lagrangian_bound.hpp"
+#include "check.hpp"
+#include "small_pairs.hpp"
+
+/**
+ * FORI_VERIFICATION fixes x_ik to zero if the Lagrangian bound plus the reduced cost of x_ik exceeds the threshold.
+ * That must never remove a solution within the threshold: every node mapping with i -> k costs at least the bound plus
+ * the reduced cost of (i, k), in particular every optimal mapping keeps all of its node pairs.
+ */
+
+int main() {
+        std::mt19937 rng(112358);
+        int fixed = 0;
+        for (int round = 0; round < 300; round++) {
+                std::uniform_int_distribution<int> nodes(1, 5);
+                auto G = random_graph(rng, nodes(rng), 0.5, 2);
+                auto H = random_graph(rng, nodes(rng), 0.5, 2);
+                auto c = random_costs(rng, G, H);
+                const double ged = exact_ged(G, H, c);
+                for (double threshold: {ged, ged + 0.5}) {
+                        LAGRANGIAN_BOUND<int, int> lagrangian(G, H, c.c_ik, c.c_ie, c.c_ek, c.c_ijkl, c.c_ije, c.c_ekl);
+                        const double bound = lagrangian.bound(threshold, 30);
+                        CHECK(bound <= ged + 1e-6);
+                        int violations = 0;
+                        for_each_mapping(G.number_of_nodes(), H.number_of_nodes(), [&](const std::vector<int> &map) {
+                                const double cost = mapping_cost(G, H, c, map);
+                                for (int i = 0; i < G.number_of_nodes(); i++) {
+                                        if (map[i] >= 0 and cost < bound + lagrangian.node_reduced_cost(i, map[i]) - 1e-6) {
+                                                violations++;
+                                        }
+                                }
+                        });
+                        CHECK(violations == 0);
+                        for (int i = 0; i < G.number_of_nodes(); i++) {
+                                for (int k = 0; k < H.number_of_nodes(); k++) {
+                                        CHECK(lagrangian.node_reduced_cost(i, k) >= -1e-9);
+                                        if (bound + lagrangian.node_reduced_cost(i, k) > threshold + 1e-6) {
+                                                fixed++;
+                                        }
+                                }
+                        }
+                }
+        }
+        // the fixing is not vacuous on these pairs
+        CHECK(fixed > 0);
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "auxiliary/io.hpp"
+#include "auxiliary/options.hpp"
+#include "check.hpp"
+
+/**
+ * IO::threshold_output() reads the result of one threshold of a sweep off the bounds of every candidate: a candidate is
+ * accepted at t if its proven upper bound is at most t, and it needed the ILP at t if it reached the ILP and the bounds
+ * known before the ILP did not reject it at t.
+ */
+
+namespace {
+        const double unknown = std::numeric_limits<double>::max();
+
+        void add(options &opt, const std::string &file, double cheap, double lower, double upper, bool ilp) {
+                opt.graphlist.push_back(file);
+                opt.candidate_cheap.push_back(cheap);
+                opt.candidate_lower.push_back(lower);
+                opt.candidate_upper.push_back(upper);
+                opt.candidate_ilp.push_back(ilp);
+                if (ilp) {
+                        opt.gurobi_needed.push_back(file);
+                }
+        }
+}
+
+int main() {
+        options opt;
+        opt.thresholds = {1.0, 2.0, 3.0, 5.0};
+        opt.threshold = 5.0;
+        // the ILP proved GED 2
+        add(opt, "exact.gxl", 1.0, 2.0, 2.0, true);
+        // the ILP rejected the pair at the largest threshold
+        add(opt, "rejected.gxl", 0.0, std::nextafter(5.0, unknown), unknown, true);
+        // the cheap bound rejected it before the ILP
+        add(opt, "filtered.gxl", 6.0, 6.0, unknown, false);
+        // the start mapping accepted it with cost 1 before the ILP, nothing is known below
+        add(opt, "heuristic.gxl", 0.0, 0.0, 1.0, false);
+        // the bound cache knew GED 3
+        add(opt, "cached.gxl", 3.0, 3.0, 3.0, false);
+        // a time limit left GED in [2, 4]
+        add(opt, "timeout.gxl", 2.0, 2.0, 4.0, true);
+        opt.accepted_graphs = {"exact.gxl", "heuristic.gxl", "cached.gxl", "timeout.gxl"};
+
+        const std::vector<std::vector<std::string>> accepted{{"heuristic.gxl"},
+                                                             {"exact.gxl", "heuristic.gxl"},
+                                                             {"exact.gxl", "heuristic.gxl", "cached.gxl"},
+                                                             {"exact.gxl", "heuristic.gxl", "cached.gxl", "timeout.gxl"}};
+        const std::vector<std::vector<std::string>> needed{{"exact.gxl", "rejected.gxl"},
+                                                           {"exact.gxl", "rejected.gxl", "timeout.gxl"},
+                                                           {"exact.gxl", "rejected.gxl", "timeout.gxl"},
+                                                           {"exact.gxl", "rejected.gxl", "timeout.gxl"}};
+        for (std::size_t t = 0; t < opt.thresholds.size(); t++) {
+                const options out = IO::threshold_output(opt, opt.thresholds[t]);
+                CHECK(out.threshold == opt.thresholds[t]);
+                CHECK(out.accepted_graphs == accepted[t]);
+                CHECK(out.gurobi_needed == needed[t]);
+                CHECK(out.upperbounds.size() == out.gurobi_needed.size());
+                CHECK(out.lowerbounds.size() == out.gurobi_needed.size());
+                // the ILP statistics stay those of the pairs that reached the ILP at the largest threshold
+                CHECK(out.ilp_pairs == opt.gurobi_needed);
+                // the sweep's own options are left alone
+                CHECK(opt.accepted_graphs.size() == 4);
+        }
+        // the largest threshold reproduces what the run accepted
+        CHECK(IO::threshold_output(opt, opt.threshold).accepted_graphs == opt.accepted_graphs);
+        // the bounds of a pair are those of the candidate
+        const options at_two = IO::threshold_output(opt, 2.0);
+        CHECK(at_two.upperbounds[2] == 4.0 && at_two.lowerbounds[2] == 2.0);
+        return failures() == 0 ? 0 : 1;
+}
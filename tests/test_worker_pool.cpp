@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "auxiliary/worker_pool.hpp"
+#include "check.hpp"
+
+/**
+ * worker_pool runs every iteration exactly once, never runs two iterations on one worker at a time and starts the most
+ * expensive iterations first, see the scheduling notes of worker_pool.hpp.
+ */
+
+void test_every_iteration_once() {
+        for (int workers: {0, 1, 3, 8}) {
+                worker_pool pool(workers);
+                CHECK(pool.size() == std::max(1, workers));
+                for (std::size_t count: {std::size_t{0}, std::size_t{1}, std::size_t{5}, std::size_t{1000}}) {
+                        std::vector<std::atomic<int>> runs(count);
+                        std::vector<std::atomic<bool>> busy(pool.size());
+                        std::atomic<int> overlaps{0};
+                        std::vector<double> cost(count);
+                        for (std::size_t i = 0; i < count; i++) {
+                                cost[i] = static_cast<double>((i * 7919) % 101);
+                        }
+                        pool.run(count, [&](int w, std::size_t i) {
+                                if (busy[w].exchange(true)) {
+                                        overlaps++;
+                                }
+                                runs[i]++;
+                                busy[w] = false;
+                        }, cost);
+                        CHECK(std::all_of(runs.begin(), runs.end(), [](const std::atomic<int> &r) { return r == 1; }));
+                        CHECK(overlaps == 0);
+                }
+        }
+}
+
+void test_most_expensive_first() {
+        // the caller alone runs the iterations by decreasing cost, ties in index order
+        worker_pool single(1);
+        const std::vector<double> cost{1.0, 50.0, 3.0, 50.0, 1e6, 0.5};
+        std::vector<std::size_t> order;
+        single.run(cost.size(), [&](int, std::size_t i) { order.push_back(i); }, cost);
+        CHECK((order == std::vector<std::size_t>{4, 1, 3, 2, 0, 5}));
+
+        // every worker starts with one of the most expensive iterations, before any cheap one starts
+        const int workers = 4;
+        worker_pool pool(workers);
+        std::vector<double> costs(64, 1.0);
+        for (int i = 0; i < workers; i++) {
+                costs[10 * i + 3] = 1000.0;
+        }
+        std::mutex mutex;
+        std::vector<std::size_t> started;
+        pool.run(costs.size(), [&](int, std::size_t i) {
+                {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        started.push_back(i);
+                }
+                if (costs[i] > 1.0) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                }
+        }, costs);
+        CHECK(started.size() == costs.size());
+        std::set<std::size_t> first(started.begin(), started.begin() + workers);
+        CHECK((first == std::set<std::size_t>{3, 13, 23, 33}));
+}
+
+void test_stealing() {
+        // all cheap iterations of a worker that is stuck on a long one are stolen by the others
+        worker_pool pool(4);
+        std::vector<double> cost(40, 1.0);
+        pool.run(cost.size(), [&](int, std::size_t i) {
+                if (i == 0) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+        }, cost);
+        CHECK(pool.steals() > 0);
+}
+
+void test_exception() {
+        worker_pool pool(3);
+        std::atomic<int> runs{0};
+        CHECK_THROWS(pool.run(100, [&](int, std::size_t i) {
+                runs++;
+                if (i == 7) {
+                        throw std::runtime_error("iteration 7");
+                }
+        }));
+        CHECK(runs <= 100);
+        // the pool is usable after a failed run
+        runs = 0;
+        pool.run(100, [&](int, std::size_t) { runs++; });
+        CHECK(runs == 100);
+}
+
+int main() {
+        test_every_iteration_once();
+        test_most_expensive_first();
+        test_stealing();
+        test_exception();
+        return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,172 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+#include "auxiliary/zip_archive.hpp"
+#include "check.hpp"
+
+namespace fs = std::filesystem;
+
+/**
+ * zip_archive reads stored and deflated entries of archives written here byte by byte, and rejects what it does not
+ * support or what is corrupt instead of reading past the data: CRC mismatches, stored entries whose size does not match
+ * their data, and zip64 archives and entries.
+ */
+
+struct member {
+        std::string name;
+        std::string contents;
+        bool deflate = false;
+        /// written instead of the real values if set
+        std::int64_t crc = -1;
+        std::int64_t size = -1;
+        std::int64_t compressed_size = -1;
+};
+
+void put_le(std::string &out, std::uint32_t value, int bytes) {
+        for (int b = 0; b < bytes; b++) {
+                out.push_back(static_cast<char>((value >> (8 * b)) & 0xff));
+        }
+}
+
+std::string deflate_raw(const std::string &in) {
+        z_stream stream{};
+        deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+        std::string out(deflateBound(&stream, in.size()), '\0');
+        stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(in.data()));
+        stream.avail_in = static_cast<uInt>(in.size());
+        stream.next_out = reinterpret_cast<Bytef *>(out.data());
+        stream.avail_out = static_cast<uInt>(out.size());
+        deflate(&stream, Z_FINISH);
+        out.resize(stream.total_out);
+        deflateEnd(&stream);
+        return out;
+}
+
+/// @brief writes the members to a temporary zip archive and returns its path, count and directory_offset override the end record
+std::string write_zip(const std::string &name, const std::vector<member> &members, std::int64_t count = -1,
+                      std::int64_t directory_offset = -1) {
+        std::string data;
+        std::string directory;
+        for (const auto &m: members) {
+                const std::string payload = m.deflate ? deflate_raw(m.contents) : m.contents;
+                const auto crc = static_cast<std::uint32_t>(m.crc >= 0 ? m.crc : crc32(0L, reinterpret_cast<const Bytef *>(m.contents.data()),
+                                                                                       static_cast<uInt>(m.contents.size())));
+                const auto size = static_cast<std::uint32_t>(m.size >= 0 ? m.size : m.contents.size());
+                const auto compressed = static_cast<std::uint32_t>(m.compressed_size >= 0 ? m.compressed_size : payload.size());
+                const auto method = m.deflate ? 8u : 0u;
+                const auto offset = static_cast<std::uint32_t>(data.size());
+
+                put_le(data, 0x04034b50, 4);
+                put_le(data, 20, 2);
+                put_le(data, 0, 2);
+                put_le(data, method, 2);
+                put_le(data, 0, 4);
+                put_le(data, crc, 4);
+                put_le(data, compressed, 4);
+                put_le(data, size, 4);
+                put_le(data, m.name.size(), 2);
+                put_le(data, 0, 2);
+                data += m.name + payload;
+
+                put_le(directory, 0x02014b50, 4);
+                put_le(directory, 20, 2);
+                put_le(directory, 20, 2);
+                put_le(directory, 0, 2);
+                put_le(directory, method, 2);
+                put_le(directory, 0, 4);
+                put_le(directory, crc, 4);
+                put_le(directory, compressed, 4);
+                put_le(directory, size, 4);
+                put_le(directory, m.name.size(), 2);
+                put_le(directory, 0, 2);
+                put_le(directory, 0, 2);
+                put_le(directory, 0, 2);
+                put_le(directory, 0, 2);
+                put_le(directory, 0, 4);
+                put_le(directory, offset, 4);
+                directory += m.name;
+        }
+        const auto offset = static_cast<std::uint32_t>(data.size());
+        data += directory;
+        put_le(data, 0x06054b50, 4);
+        put_le(data, 0, 2);
+        put_le(data, 0, 2);
+        put_le(data, count >= 0 ? count : members.size(), 2);
+        put_le(data, count >= 0 ? count : members.size(), 2);
+        put_le(data, directory.size(), 4);
+        put_le(data, directory_offset >= 0 ? directory_offset : offset, 4);
+        put_le(data, 0, 2);
+
+        const fs::path path = fs::temp_directory_path() / name;
+        std::ofstream out(path, std::ios::binary);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        return path.string();
+}
+
+void test_read() {
+        const std::string gxl = "<gxl><graph id=\"1\"><node id=\"_1\"/></graph></gxl>\n";
+        std::string repetitive;
+        for (int i = 0; i < 100; i++) {
+                repetitive += gxl;
+        }
+        zip_archive zip(write_zip("gedc_test_read.zip", {{"a.gxl", gxl}, {"b.gxl", repetitive, true}, {"empty.gxl", ""}}));
+        CHECK(zip.entries().size() == 3);
+        CHECK(zip.entries()[0].name == "a.gxl" && zip.entries()[0].method == 0);
+        CHECK(zip.entries()[1].name == "b.gxl" && zip.entries()[1].method == 8);
+        CHECK(zip.entries()[1].compressed_size < zip.entries()[1].size);
+        CHECK(zip.extract(zip.entries()[0]) == gxl);
+        CHECK(zip.extract(zip.entries()[1]) == repetitive);
+        CHECK(zip.extract(zip.entries()[2]).empty());
+}
+
+void test_corrupt_entries() {
+        const std::string gxl = "<gxl><graph id=\"1\"><node id=\"_1\"/></graph></gxl>\n";
+        member stored_crc{"stored.gxl", gxl};
+        stored_crc.crc = 0x12345678;
+        member deflated_crc{"deflated.gxl", gxl, true};
+        deflated_crc.crc = 0x12345678;
+        // stored entries claiming more or fewer bytes than they have, the copy of the longer one would run past the archive
+        member longer{"longer.gxl", gxl};
+        longer.size = static_cast<std::int64_t>(gxl.size()) + (1 << 20);
+        member shorter{"shorter.gxl", gxl};
+        shorter.size = static_cast<std::int64_t>(gxl.size()) - 4;
+        member truncated{"truncated.gxl", gxl, true};
+        truncated.size = static_cast<std::int64_t>(gxl.size()) + 4;
+        // the last entry claims more data than the archive holds
+        member beyond{"beyond.gxl", gxl};
+        beyond.size = beyond.compressed_size = 1 << 20;
+
+        zip_archive zip(write_zip("gedc_test_corrupt.zip", {stored_crc, deflated_crc, longer, shorter, truncated, beyond}));
+        CHECK(zip.entries().size() == 6);
+        for (const auto &e: zip.entries()) {
+                CHECK_THROWS(static_cast<void>(zip.extract(e)));
+        }
+}
+
+void test_unsupported() {
+        const std::string gxl = "<gxl/>\n";
+        // zip64 end of central directory: the real count and offset are in the zip64 record
+        CHECK_THROWS(zip_archive(write_zip("gedc_test_zip64_count.zip", {{"a.gxl", gxl}}, 0xffff)));
+        CHECK_THROWS(zip_archive(write_zip("gedc_test_zip64_offset.zip", {{"a.gxl", gxl}}, -1, 0xffffffff)));
+        // zip64 entry: the real sizes are in its extra field
+        member large{"large.gxl", gxl};
+        large.size = large.compressed_size = 0xffffffff;
+        CHECK_THROWS(zip_archive(write_zip("gedc_test_zip64_entry.zip", {large})));
+
+        const fs::path text = fs::temp_directory_path() / "gedc_test_not_a.zip";
+        std::ofstream(text) << "this is not a zip archive, but long enough to hold an end record";
+        CHECK_THROWS(zip_archive(text.string()));
+        CHECK_THROWS(zip_archive((fs::temp_directory_path() / "gedc_missing.zip").string()));
+}
+
+int main() {
+        test_read();
+        test_corrupt_entries();
+        test_unsupported();
+        return failures() == 0 ? 0 : 1;
+}
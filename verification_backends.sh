@@ -0,0 +1,18 @@
+# per-pair verification time of the gurobi and HiGHS backends (build with -DFORI_WITH_HIGHS=ON),
+# compare the runtimes and gurobiNeeded entries of the *_highs json files with the gurobi ones
+for b in gurobi highs
+do
+for t in 1 5 10 11 12 13 14 15 16 17 18 19 20 30 40 50
+do
+gtime -f "${b} %E %M" ./prepro_verification_aids -f FORI -b ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${t} --flat 1 -p 1 -u 1
+gtime -f "${b} %E %M" ./prepro_verification_muta -f FORI -b ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${t} --flat 1 -p 1 -u 1
+done
+for t in 1 5 10 11 12 13 14 15 16 17 18 19 20 30 40 50
+do
+scaled_t=$(awk "BEGIN {print $t * 3.575}")
+gtime -f "${b} %E %M" ./prepro_verification_aids -f FORI -b ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1 -p 1
+gtime -f "${b} %E %M" ./prepro_verification_muta -f FORI -b ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1 -p 1
+scaled_t=$(awk "BEGIN {print $t * 8.375}")
+gtime -f "${b} %E %M" ./prepro_verification_prot -f FORI -b ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1
+done
+done
@@ -0,0 +1,17 @@
+# pairs verified per second with one model per pair (batch 0) and with block-diagonal batches of tiny models,
+# divide the number of gurobiNeeded entries by the sum of their runtimes, batchSizes shows how full the batches were.
+# Not run yet: the throughput gain of batching over one model per pair is unmeasured.
+for b in 0 4 16 64
+do
+for t in 1 5 10 11 12 13 14 15 16 17 18 19 20 30 40 50
+do
+gtime -f "${b} %E %M" ./prepro_verification_aids -f FORI --batch ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${t} --flat 1 -p 1 -u 1
+gtime -f "${b} %E %M" ./prepro_verification_muta -f FORI --batch ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${t} --flat 1 -p 1 -u 1
+done
+for t in 1 5 10 11 12 13 14 15 16 17 18 19 20 30 40 50
+do
+scaled_t=$(awk "BEGIN {print $t * 3.575}")
+gtime -f "${b} %E %M" ./prepro_verification_aids -f FORI --batch ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1 -p 1
+gtime -f "${b} %E %M" ./prepro_verification_muta -f FORI --batch ${b} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1 -p 1
+done
+done
@@ -0,0 +1,19 @@
+# side-by-side benchmark of the FORI and FORI-COMPACT verification models at the thresholds of
+# verification_uniform.sh and verification_non_uniform.sh, compare modelVars, modelConstraints, lpTimes and runtimes in the json files
+# Not run yet: whether FORI-COMPACT is faster than FORI is unmeasured.
+for f in FORI FORI-COMPACT
+do
+for t in 1 5 10 11 12 13 14 15 16 17 18 19 20 30 40 50
+do
+gtime -f "${f} %E %M" ./prepro_verification_aids -f ${f} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${t} --flat 1 -p 1 -u 1
+gtime -f "${f} %E %M" ./prepro_verification_muta -f ${f} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${t} --flat 1 -p 1 -u 1
+done
+for t in 1 5 10 11 12 13 14 15 16 17 18 19 20 30 40 50
+do
+scaled_t=$(awk "BEGIN {print $t * 3.575}")
+gtime -f "${f} %E %M" ./prepro_verification_aids -f ${f} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1 -p 1
+gtime -f "${f} %E %M" ./prepro_verification_muta -f ${f} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1 -p 1
+scaled_t=$(awk "BEGIN {print $t * 8.375}")
+gtime -f "${f} %E %M" ./prepro_verification_prot -f ${f} -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1
+done
+done
@@ -0,0 +1,17 @@
+# all thresholds of verification_uniform.sh / verification_non_uniform.sh in one run per executable, one json per
+# threshold; compare the total time with the sum of the separate runs
+gtime -f "%E %M" ./prepro_verification_aids -f FORI -w . -l 1800 -t 12 -r 112358 -s 10 -v 1,5,10,11,12,13,14,15,16,17,18,19,20,30,40,50 --flat 1 -p 1 -u 1
+gtime -f "%E %M" ./prepro_verification_muta -f FORI -w . -l 1800 -t 12 -r 112358 -s 10 -v 1,5,10,11,12,13,14,15,16,17,18,19,20,30,40,50 --flat 1 -p 1 -u 1
+thresholds=""
+for t in 1 5 10 11 12 13 14 15 16 17 18 19 20 30 40 50
+do
+thresholds="${thresholds:+${thresholds},}$(awk "BEGIN {print $t * 3.575}")"
+done
+gtime -f "%E %M" ./prepro_verification_aids -f FORI -w . -l 1800 -t 12 -r 112358 -s 10 -v ${thresholds} --flat 1 -p 1
+gtime -f "%E %M" ./prepro_verification_muta -f FORI -w . -l 1800 -t 12 -r 112358 -s 10 -v ${thresholds} --flat 1 -p 1
+thresholds=""
+for t in 1 5 10 11 12 13 14 15 16 17 18 19 20 30 40 50
+do
+thresholds="${thresholds:+${thresholds},}$(awk "BEGIN {print $t * 8.375}")"
+done
+gtime -f "%E %M" ./prepro_verification_prot -f FORI -w . -l 1800 -t 12 -r 112358 -s 10 -v ${thresholds} --flat 1
@@ -0,0 +1,17 @@
+# tune the solver parameters per model size once per dataset and cost model, then verify with the profiles
+./tune_verification -d aids -o aids_uniform.profile -u 1 -t 12 -l 60 -r 112358 -v 10
+./tune_verification -d aids -o aids_non-uniform.profile -u 0 -t 12 -l 60 -r 112358 -v 35.75
+./tune_verification -d muta -o muta_uniform.profile -u 1 -t 12 -l 60 -r 112358 -v 10
+./tune_verification -d protein -o protein_non-uniform.profile -u 0 -t 12 -l 60 -r 112358 -v 83.75
+for t in 1 5 10 15 20 30 40 50
+do
+gtime -f "%E %M" ./prepro_verification_aids -f FORI --solverProfile aids_uniform.profile -w . -l 1800 -t 12 -r 112358 -s 10 -v ${t} --flat 1 -p 1 -u 1
+gtime -f "%E %M" ./prepro_verification_muta -f FORI --solverProfile muta_uniform.profile -w . -l 1800 -t 12 -r 112358 -s 10 -v ${t} --flat 1 -p 1 -u 1
+done
+for t in 1 5 10 15 20 30 40 50
+do
+scaled_t=$(awk "BEGIN {print $t * 3.575}")
+gtime -f "%E %M" ./prepro_verification_aids -f FORI --solverProfile aids_non-uniform.profile -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1 -p 1
+scaled_t=$(awk "BEGIN {print $t * 8.375}")
+gtime -f "%E %M" ./prepro_verification_prot -f FORI --solverProfile protein_non-uniform.profile -w . -l 1800 -t 12 -r 112358 -s 10 -v ${scaled_t} --flat 1
+done